@@ -0,0 +1,52 @@
+# Same output as flashgui/shaders/bin2c.exe, the CMake build embeds the compiled shaders (.cso) with it
+#   cmake -DINPUT=<file> -DOUTPUT=<path without extension> -DNAME=<symbol> -P bin2c.cmake
+# writes <OUTPUT>.h and <OUTPUT>.c declaring g_<NAME> and g_<NAME>_length
+
+if(NOT INPUT OR NOT OUTPUT OR NOT NAME)
+    message(FATAL_ERROR "bin2c.cmake needs INPUT, OUTPUT and NAME")
+endif()
+
+file(READ "${INPUT}" hex HEX)
+string(LENGTH "${hex}" hex_length)
+math(EXPR size "${hex_length} / 2")
+
+get_filename_component(header_name "${OUTPUT}.h" NAME)
+
+set(header "#pragma once\n\n#ifdef __cplusplus\nextern \"C\" {\n#endif\n")
+string(APPEND header "\textern unsigned char g_${NAME}[${size}];\n")
+string(APPEND header "\textern unsigned int g_${NAME}_length;\n")
+string(APPEND header "#ifdef __cplusplus\n}\n#endif")
+
+# 11 bytes per line like bin2c.exe
+set(bytes "")
+set(offset 0)
+while(offset LESS hex_length)
+    string(SUBSTRING "${hex}" ${offset} 22 line)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1, " line "${line}")
+    if(offset GREATER 0)
+        string(APPEND bytes "\n\t")
+    endif()
+    string(APPEND bytes "${line}")
+    math(EXPR offset "${offset} + 22")
+endwhile()
+string(REGEX REPLACE ", $" "" bytes "${bytes}")
+
+set(source "#include \"${header_name}\"\n\nunsigned char g_${NAME}[${size}] = {\n\t${bytes}\n};\n\n")
+string(APPEND source "unsigned int g_${NAME}_length = ${size};\n")
+
+# only touch the files when they change, the .c is a dependency of the library
+foreach(ext h c)
+    if(ext STREQUAL "h")
+        set(content "${header}")
+    else()
+        set(content "${source}")
+    endif()
+
+    set(existing "")
+    if(EXISTS "${OUTPUT}.${ext}")
+        file(READ "${OUTPUT}.${ext}" existing)
+    endif()
+    if(NOT existing STREQUAL content)
+        file(WRITE "${OUTPUT}.${ext}" "${content}")
+    endif()
+endforeach()
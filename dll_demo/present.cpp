@@ -27,19 +27,16 @@ HRESULT __fastcall hooks::present(IDXGISwapChain3* p_swapchain, UINT sync_interv
 }
 
 HRESULT __fastcall hooks::resize_buffers(IDXGISwapChain3* p_this, UINT buffer_count, UINT width, UINT height, DXGI_FORMAT new_format, UINT swapchain_flags) {
-	
-	//fgui::render->wait_for_gpu();
-	
-	fgui::render->release_resources();
-
-	fgui::process->window.set_size(width, height);
+	// our last frame may still reference the backbuffers, they must be released before ResizeBuffers
+	fgui::render->begin_resize();
 
 	HRESULT hr = fgui::hk::o_resize_buffers(p_this, buffer_count, width, height, new_format, swapchain_flags);
 
-	if (SUCCEEDED(hr)) {
+	if (SUCCEEDED(hr))
 		fgui::process->resize_complete();
-		fgui::render->create_resources();
-	}
+
+	// views onto the new buffers (size read back from the swapchain), or the old ones if the resize failed
+	fgui::render->end_resize();
 
 	return hr;
 }
\ No newline at end of file
@@ -0,0 +1,457 @@
+#include "pch.h"
+#include "bc_encoder.h"
+
+#include <cmath>
+#include <cfloat>
+#include <climits>
+#include <cstring>
+
+using namespace fgui;
+
+static uint16_t pack_565(const float* rgb) {
+	const int r = std::clamp(int(rgb[0] * 31.f / 255.f + 0.5f), 0, 31);
+	const int g = std::clamp(int(rgb[1] * 63.f / 255.f + 0.5f), 0, 63);
+	const int b = std::clamp(int(rgb[2] * 31.f / 255.f + 0.5f), 0, 31);
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+static void unpack_565(uint16_t c, int* rgb) {
+	const int r = (c >> 11) & 31;
+	const int g = (c >> 5) & 63;
+	const int b = c & 31;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+bool bc::has_alpha(const uint8_t* rgba, uint32_t width, uint32_t height) {
+	const size_t count = size_t(width) * height;
+	for (size_t i = 0; i < count; ++i) {
+		if (rgba[i * 4 + 3] != 255)
+			return true;
+	}
+	return false;
+}
+
+// Color endpoints are picked along the principal axis of the block (a few power iterations on the
+// covariance matrix), inset slightly, then every pixel snaps to the nearest of the 4 palette entries.
+// Always produces the 4 color mode (c0 > c1), which is also what BC3 expects.
+void bc::encode_bc1_block(const uint8_t* block_rgba, uint8_t* out) {
+	float mean[3] = {};
+	for (int i = 0; i < 16; ++i)
+		for (int c = 0; c < 3; ++c)
+			mean[c] += block_rgba[i * 4 + c];
+	for (float& m : mean)
+		m /= 16.f;
+
+	float cov[6] = {}; // rr rg rb gg gb bb
+	for (int i = 0; i < 16; ++i) {
+		const float r = block_rgba[i * 4 + 0] - mean[0];
+		const float g = block_rgba[i * 4 + 1] - mean[1];
+		const float b = block_rgba[i * 4 + 2] - mean[2];
+		cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+		cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+	}
+
+	float axis[3] = { 1.f, 1.f, 1.f };
+	for (int iter = 0; iter < 4; ++iter) {
+		const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+		const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+		const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+		const float len = std::max({ std::fabs(x), std::fabs(y), std::fabs(z) });
+		if (len < 1e-6f)
+			break;
+		axis[0] = x / len; axis[1] = y / len; axis[2] = z / len;
+	}
+
+	float min_t = FLT_MAX, max_t = -FLT_MAX;
+	for (int i = 0; i < 16; ++i) {
+		float t = 0.f;
+		for (int c = 0; c < 3; ++c)
+			t += (block_rgba[i * 4 + c] - mean[c]) * axis[c];
+		min_t = std::min(min_t, t);
+		max_t = std::max(max_t, t);
+	}
+
+	// inset the endpoints by 1/16 of the range, keeps outliers from stretching the palette
+	const float inset = (max_t - min_t) / 16.f;
+	min_t += inset;
+	max_t -= inset;
+
+	float lo[3], hi[3];
+	for (int c = 0; c < 3; ++c) {
+		lo[c] = std::clamp(mean[c] + axis[c] * min_t, 0.f, 255.f);
+		hi[c] = std::clamp(mean[c] + axis[c] * max_t, 0.f, 255.f);
+	}
+
+	uint16_t c0 = pack_565(hi);
+	uint16_t c1 = pack_565(lo);
+	if (c0 < c1)
+		std::swap(c0, c1);
+
+	uint32_t indices = 0;
+	if (c0 != c1) {
+		int palette[4][3];
+		unpack_565(c0, palette[0]);
+		unpack_565(c1, palette[1]);
+		for (int c = 0; c < 3; ++c) {
+			palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+		}
+
+		for (int i = 0; i < 16; ++i) {
+			int best = 0, best_dist = INT_MAX;
+			for (int p = 0; p < 4; ++p) {
+				int dist = 0;
+				for (int c = 0; c < 3; ++c) {
+					const int d = int(block_rgba[i * 4 + c]) - palette[p][c];
+					dist += d * d;
+				}
+				if (dist < best_dist) {
+					best_dist = dist;
+					best = p;
+				}
+			}
+			indices |= uint32_t(best) << (i * 2);
+		}
+	}
+
+	out[0] = uint8_t(c0 & 0xFF); out[1] = uint8_t(c0 >> 8);
+	out[2] = uint8_t(c1 & 0xFF); out[3] = uint8_t(c1 >> 8);
+	memcpy(out + 4, &indices, sizeof(indices));
+}
+
+// 8 value mode (a0 > a1): a0, a1 and six interpolated steps between them
+void bc::encode_bc4_block(const uint8_t* block_values, uint8_t* out) {
+	uint8_t a0 = 0, a1 = 255;
+	for (int i = 0; i < 16; ++i) {
+		a0 = std::max(a0, block_values[i]);
+		a1 = std::min(a1, block_values[i]);
+	}
+
+	uint64_t indices = 0;
+	if (a0 != a1) {
+		int palette[8] = { a0, a1 };
+		for (int p = 1; p < 7; ++p)
+			palette[p + 1] = ((7 - p) * a0 + p * a1) / 7;
+
+		for (int i = 0; i < 16; ++i) {
+			int best = 0, best_dist = INT_MAX;
+			for (int p = 0; p < 8; ++p) {
+				const int dist = std::abs(int(block_values[i]) - palette[p]);
+				if (dist < best_dist) {
+					best_dist = dist;
+					best = p;
+				}
+			}
+			indices |= uint64_t(best) << (i * 3);
+		}
+	}
+
+	out[0] = a0;
+	out[1] = a1;
+	for (int b = 0; b < 6; ++b)
+		out[2 + b] = uint8_t(indices >> (b * 8));
+}
+
+void bc::encode_bc3_block(const uint8_t* block_rgba, uint8_t* out) {
+	uint8_t alpha[16];
+	for (int i = 0; i < 16; ++i)
+		alpha[i] = block_rgba[i * 4 + 3];
+
+	encode_bc4_block(alpha, out);
+	encode_bc1_block(block_rgba, out + 8);
+}
+
+std::vector<uint8_t> bc::encode_image(const uint8_t* rgba, uint32_t width, uint32_t height, DXGI_FORMAT format) {
+	if (format != DXGI_FORMAT_BC1_UNORM && format != DXGI_FORMAT_BC3_UNORM)
+		throw std::runtime_error("bc::encode_image: only BC1 and BC3 encoding is supported");
+
+	const size_t block_bytes = format == DXGI_FORMAT_BC1_UNORM ? 8 : 16;
+	const uint32_t blocks_x = std::max(1u, (width + 3) / 4);
+	const uint32_t blocks_y = std::max(1u, (height + 3) / 4);
+
+	std::vector<uint8_t> out(size_t(blocks_x) * blocks_y * block_bytes);
+	uint8_t block[16 * 4];
+
+	for (uint32_t by = 0; by < blocks_y; ++by) {
+		for (uint32_t bx = 0; bx < blocks_x; ++bx) {
+			// gather the 4x4 block, clamping at the right/bottom edge
+			for (uint32_t y = 0; y < 4; ++y) {
+				const uint32_t sy = std::min(by * 4 + y, height - 1);
+				for (uint32_t x = 0; x < 4; ++x) {
+					const uint32_t sx = std::min(bx * 4 + x, width - 1);
+					memcpy(block + (y * 4 + x) * 4, rgba + (size_t(sy) * width + sx) * 4ull, 4);
+				}
+			}
+
+			uint8_t* dst = out.data() + (size_t(by) * blocks_x + bx) * block_bytes;
+			if (format == DXGI_FORMAT_BC1_UNORM)
+				encode_bc1_block(block, dst);
+			else
+				encode_bc3_block(block, dst);
+		}
+	}
+
+	return out;
+}
+
+static void interpolate_bc1_colors(const uint8_t* in, int palette[4][3]) {
+	const uint16_t c0 = uint16_t(in[0] | (in[1] << 8));
+	const uint16_t c1 = uint16_t(in[2] | (in[3] << 8));
+	unpack_565(c0, palette[0]);
+	unpack_565(c1, palette[1]);
+	for (int c = 0; c < 3; ++c) {
+		palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+		palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+	}
+}
+
+// BC3 is a BC4 alpha block followed by a BC1 color block that always uses the 4 color mode
+void bc::decode_bc3_block(const uint8_t* in, uint8_t* block_rgba) {
+	int alpha[8];
+	alpha[0] = in[0];
+	alpha[1] = in[1];
+	if (alpha[0] > alpha[1]) {
+		for (int i = 1; i < 7; ++i)
+			alpha[i + 1] = ((7 - i) * alpha[0] + i * alpha[1]) / 7;
+	}
+	else {
+		for (int i = 1; i < 5; ++i)
+			alpha[i + 1] = ((5 - i) * alpha[0] + i * alpha[1]) / 5;
+		alpha[6] = 0;
+		alpha[7] = 255;
+	}
+
+	uint64_t alpha_bits = 0;
+	for (int i = 0; i < 6; ++i)
+		alpha_bits |= uint64_t(in[2 + i]) << (8 * i);
+
+	int palette[4][3];
+	interpolate_bc1_colors(in + 8, palette);
+	const uint32_t color_bits = uint32_t(in[12]) | (uint32_t(in[13]) << 8) | (uint32_t(in[14]) << 16) | (uint32_t(in[15]) << 24);
+
+	for (int i = 0; i < 16; ++i) {
+		const int* rgb = palette[(color_bits >> (2 * i)) & 3];
+		block_rgba[i * 4 + 0] = uint8_t(rgb[0]);
+		block_rgba[i * 4 + 1] = uint8_t(rgb[1]);
+		block_rgba[i * 4 + 2] = uint8_t(rgb[2]);
+		block_rgba[i * 4 + 3] = uint8_t(alpha[(alpha_bits >> (3 * i)) & 7]);
+	}
+}
+
+namespace {
+	// BC7 mode layouts, see the "BC7 format" page of the D3D11 docs
+	struct bc7_mode {
+		int subsets;
+		int partition_bits;
+		int rotation_bits;
+		int selector_bits;
+		int color_bits;
+		int alpha_bits;
+		int endpoint_pbits; // one p-bit per endpoint
+		int shared_pbits;   // one p-bit per subset
+		int index_bits;
+		int index2_bits;
+	};
+
+	constexpr bc7_mode bc7_modes[8] = {
+		{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+		{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+		{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+		{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+		{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+		{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+		{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+		{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+	};
+
+	// subset of every pixel, bit i set when pixel i is in subset 1
+	constexpr uint16_t bc7_partitions2[64] = {
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+	};
+
+	// 2 bits per pixel, pixel 0 in the low bits
+	constexpr uint32_t bc7_partitions3[64] = {
+		0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+		0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+		0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+		0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+		0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+		0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+		0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+		0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+	};
+
+	// anchor pixel of the second subset (2 subsets), and of the second and third subsets (3 subsets).
+	// Subset 0 always anchors at pixel 0. An anchor's index is stored with its top bit implied 0
+	constexpr uint8_t bc7_anchor2[64] = {
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+		15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+		 6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15,
+	};
+
+	constexpr uint8_t bc7_anchor3a[64] = {
+		 3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+		 3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+		 8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+		 3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3,
+	};
+
+	constexpr uint8_t bc7_anchor3b[64] = {
+		15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+		15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+		15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+		15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8,
+	};
+
+	constexpr int bc7_weights2[4] = { 0, 21, 43, 64 };
+	constexpr int bc7_weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	constexpr int bc7_weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	class c_bit_reader {
+	public:
+		explicit c_bit_reader(const uint8_t* data) : m_data(data) {}
+
+		uint32_t read(int count) {
+			uint32_t value = 0;
+			for (int i = 0; i < count; ++i, ++m_pos)
+				value |= uint32_t((m_data[m_pos >> 3] >> (m_pos & 7)) & 1) << i;
+			return value;
+		}
+
+	private:
+		const uint8_t* m_data;
+		int m_pos = 0;
+	};
+
+	int bc7_interpolate(int e0, int e1, int index, int bits) {
+		const int* weights = bits == 2 ? bc7_weights2 : bits == 3 ? bc7_weights3 : bc7_weights4;
+		return ((64 - weights[index]) * e0 + weights[index] * e1 + 32) >> 6;
+	}
+
+	// widen a quantized endpoint to 8 bits by repeating its top bits
+	int bc7_unquantize(int value, int bits) {
+		value <<= 8 - bits;
+		return value | (value >> bits);
+	}
+}
+
+void bc::decode_bc7_block(const uint8_t* in, uint8_t* block_rgba) {
+	int mode_index = 0;
+	while (mode_index < 8 && !(in[0] & (1 << mode_index)))
+		++mode_index;
+
+	// reserved mode, decodes to transparent black
+	if (mode_index == 8) {
+		memset(block_rgba, 0, 64);
+		return;
+	}
+
+	const bc7_mode& mode = bc7_modes[mode_index];
+	c_bit_reader bits(in);
+	bits.read(mode_index + 1);
+
+	const uint32_t partition = bits.read(mode.partition_bits);
+	const uint32_t rotation = bits.read(mode.rotation_bits);
+	const uint32_t selector = bits.read(mode.selector_bits);
+
+	// [subset * 2 + endpoint][channel]
+	int endpoints[6][4] = {};
+	const int endpoint_count = mode.subsets * 2;
+	for (int c = 0; c < 3; ++c)
+		for (int e = 0; e < endpoint_count; ++e)
+			endpoints[e][c] = int(bits.read(mode.color_bits));
+	for (int e = 0; e < endpoint_count; ++e)
+		endpoints[e][3] = mode.alpha_bits ? int(bits.read(mode.alpha_bits)) : 255;
+
+	int color_bits = mode.color_bits;
+	int alpha_bits = mode.alpha_bits;
+	if (mode.endpoint_pbits || mode.shared_pbits) {
+		int pbits[6];
+		if (mode.endpoint_pbits) {
+			for (int e = 0; e < endpoint_count; ++e)
+				pbits[e] = int(bits.read(1));
+		}
+		else {
+			for (int s = 0; s < mode.subsets; ++s)
+				pbits[s * 2] = pbits[s * 2 + 1] = int(bits.read(1));
+		}
+
+		for (int e = 0; e < endpoint_count; ++e) {
+			for (int c = 0; c < 3; ++c)
+				endpoints[e][c] = (endpoints[e][c] << 1) | pbits[e];
+			if (alpha_bits)
+				endpoints[e][3] = (endpoints[e][3] << 1) | pbits[e];
+		}
+		++color_bits;
+		if (alpha_bits)
+			++alpha_bits;
+	}
+
+	for (int e = 0; e < endpoint_count; ++e) {
+		for (int c = 0; c < 3; ++c)
+			endpoints[e][c] = bc7_unquantize(endpoints[e][c], color_bits);
+		if (alpha_bits)
+			endpoints[e][3] = bc7_unquantize(endpoints[e][3], alpha_bits);
+	}
+
+	int subset_of[16] = {};
+	bool anchor[16] = {};
+	anchor[0] = true;
+	if (mode.subsets == 2) {
+		for (int i = 0; i < 16; ++i)
+			subset_of[i] = (bc7_partitions2[partition] >> i) & 1;
+		anchor[bc7_anchor2[partition]] = true;
+	}
+	else if (mode.subsets == 3) {
+		for (int i = 0; i < 16; ++i)
+			subset_of[i] = (bc7_partitions3[partition] >> (2 * i)) & 3;
+		anchor[bc7_anchor3a[partition]] = true;
+		anchor[bc7_anchor3b[partition]] = true;
+	}
+
+	int indices[16], indices2[16] = {};
+	for (int i = 0; i < 16; ++i)
+		indices[i] = int(bits.read(anchor[i] ? mode.index_bits - 1 : mode.index_bits));
+	if (mode.index2_bits) {
+		for (int i = 0; i < 16; ++i)
+			indices2[i] = int(bits.read(i == 0 ? mode.index2_bits - 1 : mode.index2_bits));
+	}
+
+	for (int i = 0; i < 16; ++i) {
+		const int* e0 = endpoints[subset_of[i] * 2];
+		const int* e1 = endpoints[subset_of[i] * 2 + 1];
+		int rgba[4];
+
+		if (mode.index2_bits) {
+			// modes 4/5 index color and alpha separately, the selector swaps which index set is which
+			const int color_index = selector ? indices2[i] : indices[i];
+			const int color_index_bits = selector ? mode.index2_bits : mode.index_bits;
+			const int alpha_index = selector ? indices[i] : indices2[i];
+			const int alpha_index_bits = selector ? mode.index_bits : mode.index2_bits;
+			for (int c = 0; c < 3; ++c)
+				rgba[c] = bc7_interpolate(e0[c], e1[c], color_index, color_index_bits);
+			rgba[3] = bc7_interpolate(e0[3], e1[3], alpha_index, alpha_index_bits);
+		}
+		else {
+			for (int c = 0; c < 4; ++c)
+				rgba[c] = bc7_interpolate(e0[c], e1[c], indices[i], mode.index_bits);
+		}
+
+		// rotation 1-3 swaps alpha with red, green or blue
+		if (rotation)
+			std::swap(rgba[3], rgba[rotation - 1]);
+
+		for (int c = 0; c < 4; ++c)
+			block_rgba[i * 4 + c] = uint8_t(rgba[c]);
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+namespace fgui {
+	// Small at-load block compressor for RGBA8 sources.
+	// BC1 for opaque images (8 bytes per 4x4 block, 8:1), BC3 when alpha is needed (16 bytes per block, 4:1).
+	// BC7 is decode-only: ship it pre-compressed in a DDS file. The decoders are for at-load fixups of DDS blocks.
+	namespace bc {
+		// true if any pixel has alpha below 255
+		bool has_alpha(const uint8_t* rgba, uint32_t width, uint32_t height);
+
+		// encode one 4x4 block, block_rgba holds 16 pixels in row-major order
+		void encode_bc1_block(const uint8_t* block_rgba, uint8_t* out);
+		void encode_bc3_block(const uint8_t* block_rgba, uint8_t* out);
+		// single channel (alpha of BC3, red of BC4)
+		void encode_bc4_block(const uint8_t* block_values, uint8_t* out);
+
+		// decode one 16 byte block into 16 RGBA8 pixels in row-major order
+		void decode_bc3_block(const uint8_t* in, uint8_t* block_rgba);
+		void decode_bc7_block(const uint8_t* in, uint8_t* block_rgba);
+
+		// compress a whole image into tightly packed blocks, edge blocks clamp to the last row/column.
+		// format must be DXGI_FORMAT_BC1_UNORM or DXGI_FORMAT_BC3_UNORM
+		std::vector<uint8_t> encode_image(const uint8_t* rgba, uint32_t width, uint32_t height, DXGI_FORMAT format);
+	}
+}
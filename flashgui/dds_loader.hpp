@@ -0,0 +1,263 @@
+#pragma once
+#include <d3d12.h>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include "bc_encoder.h"
+#include "pixel_convert.h"
+
+namespace fgui {
+	// Minimal DDS reader for block-compressed 2D textures (BC1, BC3, BC4, BC7).
+	// The blocks are kept as stored in the file so they can be uploaded without any decoding, except straight
+	// alpha BC3/BC7 which is premultiplied at load to match everything else the renderer draws.
+	struct dds_image {
+		DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t mip_levels = 1;
+		std::vector<uint8_t> data; // every mip level tightly packed, level 0 first
+
+		// bytes per 4x4 block, 0 for formats we don't handle
+		static uint32_t block_bytes(DXGI_FORMAT fmt) {
+			switch (fmt) {
+			case DXGI_FORMAT_BC1_UNORM:
+			case DXGI_FORMAT_BC1_UNORM_SRGB:
+			case DXGI_FORMAT_BC4_UNORM:
+			case DXGI_FORMAT_BC4_SNORM:
+				return 8;
+			case DXGI_FORMAT_BC3_UNORM:
+			case DXGI_FORMAT_BC3_UNORM_SRGB:
+			case DXGI_FORMAT_BC7_UNORM:
+			case DXGI_FORMAT_BC7_UNORM_SRGB:
+				return 16;
+			default:
+				return 0;
+			}
+		}
+
+		// formats with a separately stored alpha channel, the only ones where straight vs premultiplied matters
+		static bool has_alpha(DXGI_FORMAT fmt) {
+			switch (fmt) {
+			case DXGI_FORMAT_BC3_UNORM:
+			case DXGI_FORMAT_BC3_UNORM_SRGB:
+			case DXGI_FORMAT_BC7_UNORM:
+			case DXGI_FORMAT_BC7_UNORM_SRGB:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		static size_t row_pitch(DXGI_FORMAT fmt, uint32_t w) {
+			return size_t(std::max(1u, (w + 3) / 4)) * block_bytes(fmt);
+		}
+
+		static size_t slice_pitch(DXGI_FORMAT fmt, uint32_t w, uint32_t h) {
+			return row_pitch(fmt, w) * size_t(std::max(1u, (h + 3) / 4));
+		}
+
+		// one D3D12_SUBRESOURCE_DATA per mip level, pointing into data
+		std::vector<D3D12_SUBRESOURCE_DATA> subresources() const {
+			std::vector<D3D12_SUBRESOURCE_DATA> subs(mip_levels);
+
+			size_t offset = 0;
+			uint32_t w = width, h = height;
+			for (uint32_t level = 0; level < mip_levels; ++level) {
+				subs[level].pData = data.data() + offset;
+				subs[level].RowPitch = static_cast<LONG_PTR>(row_pitch(format, w));
+				subs[level].SlicePitch = static_cast<LONG_PTR>(slice_pitch(format, w, h));
+
+				offset += slice_pitch(format, w, h);
+				w = std::max(1u, w / 2);
+				h = std::max(1u, h / 2);
+			}
+			return subs;
+		}
+	};
+
+	namespace dds {
+		constexpr uint32_t magic = 0x20534444; // "DDS "
+
+		constexpr uint32_t make_fourcc(char a, char b, char c, char d) {
+			return uint32_t(uint8_t(a)) | (uint32_t(uint8_t(b)) << 8) | (uint32_t(uint8_t(c)) << 16) | (uint32_t(uint8_t(d)) << 24);
+		}
+
+		constexpr uint32_t flag_mipmap_count = 0x20000; // DDSD_MIPMAPCOUNT
+		constexpr uint32_t pf_fourcc = 0x4; // DDPF_FOURCC
+		constexpr uint32_t caps2_cubemap = 0x200;
+		constexpr uint32_t caps2_volume = 0x200000;
+
+		// DDS_HEADER_DXT10::miscFlags2 & alpha_mode_mask
+		constexpr uint32_t alpha_mode_mask = 0x7;
+		constexpr uint32_t alpha_mode_premultiplied = 2;
+		constexpr uint32_t alpha_mode_opaque = 3;
+
+#pragma pack(push, 1)
+		struct pixel_format {
+			uint32_t size;
+			uint32_t flags;
+			uint32_t fourcc;
+			uint32_t rgb_bit_count;
+			uint32_t r_mask, g_mask, b_mask, a_mask;
+		};
+
+		struct header {
+			uint32_t size;
+			uint32_t flags;
+			uint32_t height;
+			uint32_t width;
+			uint32_t pitch_or_linear_size;
+			uint32_t depth;
+			uint32_t mip_map_count;
+			uint32_t reserved1[11];
+			pixel_format ddspf;
+			uint32_t caps, caps2, caps3, caps4;
+			uint32_t reserved2;
+		};
+
+		struct header_dx10 {
+			uint32_t dxgi_format;
+			uint32_t resource_dimension;
+			uint32_t misc_flag;
+			uint32_t array_size;
+			uint32_t misc_flags2;
+		};
+#pragma pack(pop)
+
+		static_assert(sizeof(header) == 124, "DDS header must be 124 bytes");
+		static_assert(sizeof(header_dx10) == 20, "DDS DX10 header must be 20 bytes");
+
+		// premultiply straight alpha BC3/BC7 blocks in place, every mip level. Each block is decoded, premultiplied
+		// and re-encoded as BC3: same 16 bytes per block, and there is no BC7 encoder to go back to
+		inline void premultiply_blocks(dds_image& img) {
+			const bool bc7 = img.format == DXGI_FORMAT_BC7_UNORM || img.format == DXGI_FORMAT_BC7_UNORM_SRGB;
+			const bool srgb = img.format == DXGI_FORMAT_BC3_UNORM_SRGB || img.format == DXGI_FORMAT_BC7_UNORM_SRGB;
+
+			uint8_t texels[16 * 4];
+			for (size_t offset = 0; offset + 16 <= img.data.size(); offset += 16) {
+				uint8_t* block = img.data.data() + offset;
+				if (bc7)
+					bc::decode_bc7_block(block, texels);
+				else
+					bc::decode_bc3_block(block, texels);
+
+				px::premultiply_rgba(texels, 16);
+				bc::encode_bc3_block(texels, block);
+			}
+
+			img.format = srgb ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+		}
+	}
+
+	// parse a DDS file held in memory, throws std::runtime_error on anything we can't upload
+	inline dds_image parse_dds(const uint8_t* bytes, size_t size) {
+		if (!bytes || size < sizeof(uint32_t) + sizeof(dds::header))
+			throw std::runtime_error("DDS: file too small");
+
+		uint32_t magic = 0;
+		memcpy(&magic, bytes, sizeof(magic));
+		if (magic != dds::magic)
+			throw std::runtime_error("DDS: bad magic");
+
+		dds::header hdr{};
+		memcpy(&hdr, bytes + sizeof(uint32_t), sizeof(hdr));
+		if (hdr.size != sizeof(dds::header) || hdr.ddspf.size != sizeof(dds::pixel_format))
+			throw std::runtime_error("DDS: malformed header");
+
+		if (hdr.caps2 & (dds::caps2_cubemap | dds::caps2_volume))
+			throw std::runtime_error("DDS: cubemaps and volume textures are not supported");
+
+		size_t offset = sizeof(uint32_t) + sizeof(dds::header);
+
+		dds_image img{};
+		img.width = hdr.width;
+		img.height = hdr.height;
+		img.mip_levels = (hdr.flags & dds::flag_mipmap_count) && hdr.mip_map_count > 0 ? hdr.mip_map_count : 1;
+
+		if (!(hdr.ddspf.flags & dds::pf_fourcc))
+			throw std::runtime_error("DDS: only block-compressed (FourCC) files are supported");
+
+		// most tools write straight alpha, only DXT4 and the DX10 alpha mode say otherwise
+		bool premultiplied = false;
+
+		switch (hdr.ddspf.fourcc) {
+		case dds::make_fourcc('D', 'X', 'T', '4'): premultiplied = true; [[fallthrough]];
+		case dds::make_fourcc('D', 'X', 'T', '1'): img.format = DXGI_FORMAT_BC1_UNORM; break;
+		case dds::make_fourcc('D', 'X', 'T', '5'): img.format = DXGI_FORMAT_BC3_UNORM; break;
+		case dds::make_fourcc('A', 'T', 'I', '1'):
+		case dds::make_fourcc('B', 'C', '4', 'U'): img.format = DXGI_FORMAT_BC4_UNORM; break;
+		case dds::make_fourcc('B', 'C', '4', 'S'): img.format = DXGI_FORMAT_BC4_SNORM; break;
+		case dds::make_fourcc('D', 'X', '1', '0'): {
+			if (size < offset + sizeof(dds::header_dx10))
+				throw std::runtime_error("DDS: truncated DX10 header");
+
+			dds::header_dx10 ext{};
+			memcpy(&ext, bytes + offset, sizeof(ext));
+			offset += sizeof(ext);
+
+			if (ext.resource_dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || ext.array_size > 1)
+				throw std::runtime_error("DDS: only single 2D textures are supported");
+
+			img.format = static_cast<DXGI_FORMAT>(ext.dxgi_format);
+			const uint32_t alpha_mode = ext.misc_flags2 & dds::alpha_mode_mask;
+			premultiplied = alpha_mode == dds::alpha_mode_premultiplied || alpha_mode == dds::alpha_mode_opaque;
+			break;
+		}
+		default:
+			throw std::runtime_error("DDS: unsupported FourCC");
+		}
+
+		if (dds_image::block_bytes(img.format) == 0)
+			throw std::runtime_error("DDS: unsupported DXGI format " + std::to_string(img.format));
+
+		if (img.width == 0 || img.height == 0)
+			throw std::runtime_error("DDS: zero sized texture");
+
+		// D3D12 requires the top level of a block-compressed texture to be block aligned
+		if (img.width % 4 != 0 || img.height % 4 != 0)
+			throw std::runtime_error("DDS: BC texture dimensions must be multiples of 4");
+
+		// don't trust the mip count further than the chain can actually go
+		uint32_t max_levels = 1;
+		for (uint32_t dim = std::max(img.width, img.height); dim > 1; dim >>= 1)
+			++max_levels;
+		img.mip_levels = std::min(img.mip_levels, max_levels);
+
+		size_t total = 0;
+		uint32_t w = img.width, h = img.height;
+		for (uint32_t level = 0; level < img.mip_levels; ++level) {
+			total += dds_image::slice_pitch(img.format, w, h);
+			w = std::max(1u, w / 2);
+			h = std::max(1u, h / 2);
+		}
+
+		if (size < offset + total)
+			throw std::runtime_error("DDS: file is smaller than its mip chain");
+
+		img.data.assign(bytes + offset, bytes + offset + total);
+
+		// BC1 decodes its transparent texels to black and BC4 has no alpha, both already read as premultiplied
+		if (!premultiplied && dds_image::has_alpha(img.format))
+			dds::premultiply_blocks(img);
+		return img;
+	}
+
+	inline dds_image load_dds_file(const std::string& path) {
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+			throw std::runtime_error("DDS: failed to open " + path);
+
+		const std::streamsize size = file.tellg();
+		file.seekg(0, std::ios::beg);
+
+		std::vector<uint8_t> bytes(static_cast<size_t>(size));
+		if (!file.read(reinterpret_cast<char*>(bytes.data()), size))
+			throw std::runtime_error("DDS: failed to read " + path);
+
+		return parse_dds(bytes.data(), bytes.size());
+	}
+}
@@ -13,6 +13,10 @@
 #include "root_sig_builder.hpp"
 #include "pso_builder.hpp"
 #include "frame_resource.hpp"
+#include "gpu_profiler.h"
+#include "text_expander.h"
+#include "tile_binner.h"
+#include "instance_culler.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -40,6 +44,16 @@ namespace fgui {
 		}
 	};
 
+	static_assert(sizeof(shape_instance) == 60, "vertex_pull.hlsl reads shape_instance with a 60 byte stride");
+
+	// shape_type bit: the instance moves by the late latched cursor offset (vertex.hlsl's LatchCB)
+	constexpr uint32_t cursor_relative_flag = 0x80000000u;
+
+	// vertex.hlsl's LatchCB, in the frame's upload heap and written by submit right before ExecuteCommandLists
+	struct late_latch_cb {
+		DirectX::XMFLOAT2 cursor_offset; // cursor now minus s_dxgicontext::cursor_base
+	};
+
 	// Vertex structure: float2 position
 	static const float quad_vertices[4][2] = {
 		{ 0.0f, 0.0f }, // bottom-left
@@ -54,13 +68,95 @@ namespace fgui {
 	};
 
 
+	// how far the CPU may run ahead of the GPU in standalone mode
+	enum class latency_mode {
+		throughput, // up to max_frame_latency frames queued, CPU and GPU overlap fully
+		low_latency // one frame queued, input is sampled as late as possible
+	};
+
+	// how the quad shaders get their vertices
+	enum class vertex_path {
+		input_assembler, // static quad VB/IB + per instance vertex buffer through the input layout
+		vertex_pulling   // corners from SV_VertexID, instances read from a root SRV, no VB/IB at all
+	};
+
+	// pixel shader permutations, one per group of shape types with a similar cost (see pixel.hlsl).
+	// generic handles every type and is used when the family PSOs failed to build
+	enum class ps_family : uint32_t {
+		generic,
+		shapes,  // quad, quad outline, line, triangle
+		circles, // circle, circle outline
+		text,    // glyph quads
+		images   // point and trilinear image quads
+	};
+	constexpr size_t ps_family_count = 5;
+
+	inline ps_family family_of(uint32_t shape_type) {
+		switch (shape_type & ~cursor_relative_flag) {
+		case 0: case 1: case 4: case 6: case 7: return ps_family::shapes;
+		case 2: case 3: return ps_family::circles;
+		case 5: return ps_family::text;
+		case 8: case 9: return ps_family::images;
+		default: return ps_family::generic;
+		}
+	}
+
+	// debug views, replace the normal output to show where a slow frame goes
+	enum class debug_view {
+		none,
+		overdraw, // every covered pixel adds heat instead of being shaded, the backbuffer is cleared to black first
+		batches   // normal shading, every draw call tinted with its own color
+	};
+
+	// what the overlay recorded into the frame's command list, the debug views' on-screen counters
+	struct frame_draw_stats {
+		uint32_t instances = 0;
+		uint32_t batches = 0;          // draw calls, a static layer counts the draws its bundles replay
+		uint32_t descriptor_binds = 0; // SetGraphicsRootDescriptorTable, outside bundles
+		uint32_t pso_binds = 0;        // SetPipelineState, outside bundles
+		uint32_t tiled_instances = 0;  // shaded by the tile path instead of as quads
+		uint32_t culled_instances = 0; // removed by the CPU cull, the GPU pass's count stays on the GPU
+		uint64_t upload_bytes = 0;     // written to the frame's upload heap
+	};
+
+	// how often and how long begin_frame blocked before it could reuse a frame resource
+	struct frame_wait_stats {
+		uint64_t frames = 0;
+		uint64_t waits = 0; // frames that actually had to block
+		double total_ms = 0.0;
+		double max_ms = 0.0;
+		double last_ms = 0.0; // 0 when the last frame didn't block
+	};
+
+	struct frame_packet;
+	struct static_layer;
+	struct offscreen_panel;
+	struct window_viewport;
+
+	// static layer resources replaced while a frame in flight may still use them
+	struct retired_layer {
+		ComPtr<ID3D12Resource> instances;
+		ComPtr<ID3D12CommandAllocator> allocator;
+		std::vector<ComPtr<ID3D12GraphicsCommandList>> bundles;
+		std::vector<UINT64> fences; // per frame resource, same scheme as c_fonts::release_image
+	};
+
+	struct family_run {
+		ps_family family;
+		uint32_t start; // relative to the grouped output
+		uint32_t count;
+	};
+
 	struct draw_cmd {
 		uint32_t bucket;
 		uint32_t start;
 		uint32_t count;
+		ps_family family;
 	};
 
 	struct s_dxgicontext {
+		c_process* process = nullptr; // window and input this context draws for, set by c_renderer
+
 		// Core DXGI components
 		ComPtr<IDXGIFactory7> dxgi_factory;
 		ComPtr<IDXGIAdapter1> adapter;
@@ -70,6 +166,15 @@ namespace fgui {
 
 		D3D12_VIEWPORT viewport = {}; // viewport for rendering
 		D3D12_RECT scissor_rect = {}; // scissor rectangle for rendering
+		D3D12_CPU_DESCRIPTOR_HANDLE target_rtv = {}; // bound on the open list, a panel or viewport while they draw
+
+		// what bind_target replaced, restore_target puts it back
+		struct target_state {
+			D3D12_CPU_DESCRIPTOR_HANDLE rtv;
+			D3D12_VIEWPORT viewport;
+			D3D12_RECT scissor_rect, clip_rect;
+			DirectX::XMMATRIX projection;
+		};
 
 		uint32_t frame_index = 0; // current frame index
 
@@ -84,8 +189,44 @@ namespace fgui {
 		ComPtr<ID3D12RootSignature> root_sig; // root signature for the pipeline
 		ComPtr<ID3D12PipelineState> pso_triangle; // pipeline state object for triangles
 
+		// vertex pulling variant, null when its PSO failed to build
+		ComPtr<ID3D12RootSignature> root_sig_pull;
+		ComPtr<ID3D12PipelineState> pso_pull;
+
+		// per family permutations, [0] is the vertex path's generic PSO. Missing entries fall back to it
+		ComPtr<ID3D12PipelineState> family_psos[2][ps_family_count];
+		bool group_families = false; // family PSOs built, batches are split and regrouped by family
+		ID3D12PipelineState* bound_pso = nullptr; // on the open command list, null after a bundle
+
+		// overdraw debug view per vertex path, null when its PSO failed to build
+		ComPtr<ID3D12PipelineState> overdraw_psos[2];
+		// compute paths, each unavailable when its PSOs failed to build
+		c_text_expander text_expander; // draw_text runs expanded into glyph quads
+		c_tile_binner tile_binner;     // bucket 0 shaded per screen tile
+		tile_mode requested_tiles = tile_mode::automatic;
+		c_instance_culler instance_culler; // clip culling on the GPU
+		cull_mode requested_cull = cull_mode::cpu;
+		D3D12_RECT clip_rect = {}; // scissor on the open list, what flush culls against
+
+		// late latch, cursor_relative_flag instances are offset by the cursor's movement since cursor_base
+		vec2i cursor_base;              // the cursor the frame was built with, begin_frame takes process->input's
+		late_latch_cb* latch = nullptr; // the open frame's slot in its upload heap
+		D3D12_GPU_VIRTUAL_ADDRESS latch_va = 0;
+
+		debug_view requested_debug = debug_view::none;
+		debug_view frame_debug = debug_view::none; // latched by begin_frame, the debug overlay turns it off for its panel
+		frame_draw_stats draw_stats{}; // reset by begin_frame
+
+		vertex_path requested_path = vertex_path::input_assembler;
+		vertex_path frame_path = vertex_path::input_assembler; // latched by begin_frame, a frame never mixes paths
+
 		std::unique_ptr<c_shader_loader> shaders; // shader loader
 
+		// PSOs persisted across launches, set before initialize. empty path = c_pipeline_cache::default_path()
+		bool use_pipeline_cache = true;
+		std::string pipeline_cache_path;
+		c_pipeline_cache pipeline_cache;
+
 		ComPtr<ID3D12DescriptorHeap> rtv_heap; // render target view heap
 
 		uint32_t rtv_descriptor_size = 0; // size of render target view descriptor
@@ -94,6 +235,7 @@ namespace fgui {
 		uint32_t buffer_count = 4; // default buffer count for swapchain
 
 		std::vector<draw_cmd> draw_stack;
+		std::vector<family_run> family_runs; // flush scratch
 
 		DXGI_FORMAT dxgiformat = DXGI_FORMAT_R8G8B8A8_UNORM;
 		UINT sample_count = 1; // desired multi-sampling level (e.g., 2, 4, 8)
@@ -103,24 +245,107 @@ namespace fgui {
 		UINT sync_interval = 0; // v-sync off by default
 		UINT swapchain_flags = 0; // no special flags by default
 
+		// standalone swapchain creation flags, ResizeBuffers has to be called with the same ones
+		UINT swapchain_create_flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING | DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+		latency_mode latency = latency_mode::throughput;
+		UINT max_frame_latency = 2; // frames queued ahead in throughput mode
+		HANDLE frame_latency_waitable = nullptr; // signalled by DXGI when a new frame may start
+
+		bool frame_open = false; // command list is recording between begin_frame and submit/skip_frame
+		bool latency_slot_held = false; // set by skip_frame, begin_frame must not wait on the waitable again
+
+		frame_wait_stats wait_stats{};
+
+		std::vector<retired_layer> retired_layers;
+		std::vector<static_layer*> pending_layer_uploads; // copies recorded into the open frame, undone by skip_frame
+		std::vector<offscreen_panel*> pending_panel_renders; // same for panel targets
+		std::vector<window_viewport*> frame_viewports; // drawn into the open frame, presented after it
+		target_state viewport_saved{}; // the frame's target while a viewport draws
+		window_viewport* active_viewport = nullptr;
+
+		// Present1 dirty rects for the next submit (standalone), empty = whole backbuffer
+		std::vector<RECT> dirty_rects;
+
+		c_gpu_profiler gpu_profiler;
+		uint64_t frame_number = 0;
+		std::chrono::steady_clock::time_point record_start{}; // set once begin_frame is done waiting
+
 		std::unique_ptr<c_fonts> fonts;
 
 		bool hooked = false;
+		bool headless = false; // no swapchain, back_buffers are our own textures and frames rotate through them
 
+		// back buffer readback, requested for the next submit and copied out once its fence passes
+		bool capture_requested = false;
+		ComPtr<ID3D12Resource> readback; // readback heap, one footprint of the back buffer
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT readback_footprint{};
+		uint32_t capture_slot = 0; // frame resource whose fence covers the copy
+		UINT64 capture_fence = 0;  // 0 = nothing captured yet
+
+		void create_device(); // factory, adapter, device and queue
 		void create_device_and_swapchain();
 		void create_rtv_heap();
 		void wait_for_gpu();
+		void wait_for_frame(frame_resource& fr);
+		void set_frame_latency(latency_mode mode, UINT max_latency);
+		void close_frame_latency_waitable(); // GetFrameLatencyWaitableObject hands out a handle we own
+		bool set_vertex_path(vertex_path path); // false when vertex pulling isn't available, applies next frame
+		void create_quad_geometry(); // static quad VB/IB, only needed by the input assembler path
+		void bind_instances(ID3D12GraphicsCommandList* cmd, D3D12_GPU_VIRTUAL_ADDRESS va, size_t bytes);
+		void draw_instances(ID3D12GraphicsCommandList* cmd, uint32_t start, uint32_t count);
+		void bind_quad_root(ID3D12GraphicsCommandList* cmd); // frame path's root signature, projection and latch CBV
+		void latch_cursor(); // freshest cursor into the open frame's latch, right before it's executed
+		ComPtr<ID3D12Resource> create_uav_buffer(size_t bytes, const wchar_t* name); // default heap, common state
+		bool set_cull_mode(cull_mode mode); // false when the GPU pass isn't available
+		void set_clip(const D3D12_RECT& rect); // scissor for the following draws, also what flush culls against
+		bool set_debug_view(debug_view view); // false when the overdraw PSO isn't available, applies next frame
+		ID3D12PipelineState* pso_for(ps_family family) const; // current frame's vertex path and debug view
+		bool bind_family(ID3D12GraphicsCommandList* cmd, ps_family family, ID3D12PipelineState*& bound) const; // true if it set a PSO
 		void release_resources();
 		void create_resources();
+		void release_backbuffers();
+		void update_viewport(); // viewport, scissor and projection from the window size
+		void resize(UINT width, UINT height); // standalone, keeps frame resources alive
+		void after_external_resize(); // hooked, after the host's ResizeBuffers
+		void set_buffer_count(UINT count);
 		void begin_frame();
-		void end_frame(std::vector<std::vector<shape_instance>>& shapes);
+		void flush(std::vector<std::vector<shape_instance>>& shapes); // record queued instances, the list stays open
+		void draw_packet(const frame_packet& packet, const D3D12_RECT* clip = nullptr); // record a packet built on another thread, clip defaults to the target
+		void draw_layer(static_layer& layer, const D3D12_RECT& scissor); // upload/record if needed, then ExecuteBundle
+		void release_layer(static_layer& layer, bool instances, bool bundles); // GPU side, freed once no frame uses it
+		void collect_retired_layers();
+		// clear the panel's target and draw its layer into it, the frame's target comes back afterwards. False when
+		// panels can't be cached (multisampled swapchain), the caller draws the layer's instances directly then
+		bool render_panel(offscreen_panel& panel);
+		void release_panel(offscreen_panel& panel); // target and layer, freed once no frame uses them
+		// render target, viewport, scissor and projection for a size x size target, the old ones are returned
+		target_state bind_target(D3D12_CPU_DESCRIPTOR_HANDLE rtv, vec2i size);
+		void restore_target(const target_state& state);
+		void create_viewport(window_viewport& vp); // swapchain for vp.hwnd, same format as the main one
+		void create_viewport_buffers(window_viewport& vp);
+		void begin_viewport(window_viewport& vp); // draws go to vp's back buffer until end_viewport
+		void end_viewport();
+		void release_viewport(window_viewport& vp); // waits for the GPU, viewports come and go rarely
+		void drop_pending_uploads(); // the open list won't run, uploads recorded into it happen again later
+		void submit(); // transition, close, execute and present (standalone)
+		void skip_frame(); // close the list without executing or presenting it
+		void end_frame(std::vector<std::vector<shape_instance>>& shapes); // flush + submit
 		void create_backbuffers();
 		void resize_backbuffers(UINT width, UINT height, DXGI_FORMAT format) const;
 		
 		void create_pipeline();
+		// every quad PSO shares the target, blend and sample state, created through pipeline_cache. The input
+		// layout is only set for root_sig, blend defaults to premultiplied alpha
+		ComPtr<ID3D12PipelineState> build_quad_pso(const ComPtr<ID3DBlob>& vs, const ComPtr<ID3DBlob>& ps,
+			const ComPtr<ID3D12RootSignature>& signature, const std::string& name, const D3D12_BLEND_DESC* blend = nullptr);
 		void initialize(IDXGISwapChain3* swapchain = nullptr, ID3D12CommandQueue* cmd_queue = nullptr, UINT sync_interval = 1, UINT flags = 0);
 		void initialize_hooked();
 		void initialize_standalone(const uint32_t& target_buf_count);
+		void initialize_headless();
+		void record_capture(); // back buffer into readback, recorded by submit when capture_requested
+		// waits for the captured frame, then copies it out as RGBA8 rows of size.x pixels. False without a capture
+		bool read_capture(std::vector<uint8_t>& rgba, vec2i& size);
 
 		frame_resource& get_current_frame_resource() {
 			return frame_resources[frame_index];
@@ -145,7 +370,15 @@ namespace fgui {
 			frame_resources.resize(buffer_count);
 		}
 
-		// Persistent quad geometry (uploaded once at init, never changes)
+		~s_dxgicontext() {
+			close_frame_latency_waitable();
+		}
+
+		// owns the latency waitable handle
+		s_dxgicontext(const s_dxgicontext&) = delete;
+		s_dxgicontext& operator=(const s_dxgicontext&) = delete;
+
+		// Persistent quad geometry (uploaded on first use by the input assembler path, never changes)
 		ComPtr<ID3D12Resource> quad_vb;
 		ComPtr<ID3D12Resource> quad_ib;
 		D3D12_VERTEX_BUFFER_VIEW quad_vbv{};
@@ -0,0 +1,107 @@
+#include "pch.h"
+#include "family_batcher.h"
+#include "redraw_tracker.h"
+#include <cmath>
+
+using namespace fgui;
+
+namespace {
+	// how many groups back an instance may move, bounds the cost per instance
+	constexpr size_t max_lookback = 8;
+
+	struct group {
+		ps_family family;
+		RECT bounds; // union of every instance in the group, conservative overlap test
+		uint32_t count;
+		uint32_t offset;
+	};
+
+	inline bool overlaps(const RECT& a, const RECT& b) {
+		return a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+	}
+
+	// scratch reused across calls, group_by_family runs on the recording thread only
+	thread_local std::vector<group> t_groups;
+	thread_local std::vector<uint32_t> t_group_of;
+}
+
+void fgui::group_by_family(const shape_instance* in, size_t count, shape_instance* out, std::vector<family_run>& runs, bool grouping) {
+	runs.clear();
+	if (!count)
+		return;
+
+	if (!grouping) {
+		memcpy(out, in, count * sizeof(shape_instance));
+		runs.push_back({ ps_family::generic, 0, static_cast<uint32_t>(count) });
+		return;
+	}
+
+	// text and image buckets are one family, skip the overlap tests
+	const ps_family first = family_of(in[0].shape_type);
+	size_t i = 1;
+	while (i < count && family_of(in[i].shape_type) == first)
+		++i;
+
+	if (i == count) {
+		memcpy(out, in, count * sizeof(shape_instance));
+		runs.push_back({ first, 0, static_cast<uint32_t>(count) });
+		return;
+	}
+
+	std::vector<group>& groups = t_groups;
+	std::vector<uint32_t>& group_of = t_group_of;
+	groups.clear();
+	group_of.resize(count);
+
+	for (size_t n = 0; n < count; ++n) {
+		const ps_family family = family_of(in[n].shape_type);
+		const RECT bounds = c_redraw_tracker::bounds_of(in[n]);
+
+		// walk back over the newest groups, join one of our family unless something in between overlaps
+		size_t target = SIZE_MAX;
+		const size_t stop = groups.size() > max_lookback ? groups.size() - max_lookback : 0;
+		for (size_t g = groups.size(); g-- > stop;) {
+			if (groups[g].family == family) {
+				target = g;
+				break;
+			}
+			if (overlaps(groups[g].bounds, bounds))
+				break;
+		}
+
+		if (target == SIZE_MAX) {
+			target = groups.size();
+			groups.push_back({ family, bounds, 0, 0 });
+		}
+		else {
+			RECT& b = groups[target].bounds;
+			b.left = std::min(b.left, bounds.left);
+			b.top = std::min(b.top, bounds.top);
+			b.right = std::max(b.right, bounds.right);
+			b.bottom = std::max(b.bottom, bounds.bottom);
+		}
+
+		++groups[target].count;
+		group_of[n] = static_cast<uint32_t>(target);
+	}
+
+	uint32_t offset = 0;
+	for (group& g : groups) {
+		g.offset = offset;
+		runs.push_back({ g.family, offset, g.count });
+		offset += g.count;
+	}
+
+	// stable scatter, instances keep their relative order inside a group
+	for (size_t n = 0; n < count; ++n)
+		out[groups[group_of[n]].offset++] = in[n];
+}
+
+DirectX::XMFLOAT4 fgui::batch_color(uint32_t index) {
+	const float h = std::fmod(index * 0.618034f, 1.f) * 6.f;
+	const float x = 1.f - std::fabs(std::fmod(h, 2.f) - 1.f);
+
+	const float rgb[6][3] = { { 1, x, 0 }, { x, 1, 0 }, { 0, 1, x }, { 0, x, 1 }, { x, 0, 1 }, { 1, 0, x } };
+	const float* c = rgb[std::min(static_cast<int>(h), 5)];
+	return { 0.25f + 0.75f * c[0], 0.25f + 0.75f * c[1], 0.25f + 0.75f * c[2], 1.f };
+}
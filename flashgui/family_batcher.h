@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "dxgicontext.h"
+
+namespace fgui {
+	// Copies count instances to out regrouped into runs of one pixel shader family. An instance only moves
+	// in front of instances it doesn't overlap, so the blended result is the same as the original order.
+	// With grouping off (family PSOs unavailable) it's a plain copy and one generic run.
+	void group_by_family(const shape_instance* in, size_t count, shape_instance* out, std::vector<family_run>& runs, bool grouping);
+
+	// batches debug view: neighbouring draws get clearly different hues, golden ratio steps around the circle
+	DirectX::XMFLOAT4 batch_color(uint32_t index);
+}
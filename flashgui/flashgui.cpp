@@ -14,42 +14,48 @@ namespace fgui {
 	hk::fn_present hk::o_present = nullptr;
 	hk::fn_resize_buffers hk::o_resize_buffers = nullptr;
 
-	bool initialize(UINT buffer_count, IDXGISwapChain3* swapchain, ID3D12CommandQueue* cmd_queue) {
-		if (!render) {
-			process = std::make_unique<c_process>();
+	instance create_instance(UINT buffer_count) {
+		instance inst;
+		inst.process = std::make_unique<c_process>(true, GetCurrentProcessId(), GetModuleHandleA(nullptr));
+		inst.render = std::make_unique<c_renderer>(inst.process.get(), D3D_FEATURE_LEVEL_12_1, buffer_count);
+		inst.render->initialize();
+		return inst;
+	}
 
-			render = std::make_unique<c_renderer>(D3D_FEATURE_LEVEL_12_1, buffer_count);
+	instance create_headless(vec2i size, UINT buffer_count) {
+		instance inst;
+		inst.process = std::make_unique<c_process>(size);
+		inst.render = std::make_unique<c_renderer>(inst.process.get(), D3D_FEATURE_LEVEL_12_1, buffer_count);
+		inst.render->initialize();
+		return inst;
+	}
 
-			if (!render) {
-				std::cerr << "[flashgui] Failed to create renderer instance" << std::endl;
-				return false; // initialization failed
-			}
+	// the old renderer goes first, it still draws for the old process
+	static void set_globals(instance&& inst) {
+		render = std::move(inst.render);
+		process = std::move(inst.process);
+	}
 
-			render->initialize(swapchain, cmd_queue);
+	bool initialize(UINT buffer_count, IDXGISwapChain3* swapchain, ID3D12CommandQueue* cmd_queue) {
+		if (!render) {
+			instance inst;
+			inst.process = std::make_unique<c_process>();
+			inst.render = std::make_unique<c_renderer>(inst.process.get(), D3D_FEATURE_LEVEL_12_1, buffer_count);
+			inst.render->initialize(swapchain, cmd_queue);
 
-			SetWindowLongPtr(process->window.handle, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(render.get()));	
+			set_globals(std::move(inst));
 		}
 		return true; // initialization successful
 	}
 
 	bool initialize(UINT buffer_count, render_mode draw_mode, HWND in_hwnd) {
-
-		process = std::make_unique<c_process>(true, GetCurrentProcessId(), GetModuleHandleA(nullptr), in_hwnd);
-		render = std::make_unique<c_renderer>(D3D_FEATURE_LEVEL_12_1, buffer_count);
-
-		if (!render) {
-			std::cerr << "[flashgui] Failed to create renderer instance" << std::endl;
-			return false; // initialization failed
-		}
-		render->initialize();
-		SetWindowLongPtr(process->window.handle, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(render.get()));
+		set_globals(create_instance(buffer_count));
 		return true;
 	}
 
 	bool initialize(DWORD processID, HINSTANCE dll_module, HWND in_hwnd) {
 		try {
 			hk::hookinfo = hk::get_info(processID, dll_module, in_hwnd);
-			SetWindowLongPtr(process->window.handle, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(render.get()));
 			return true; // initialization successful
 		}
 		catch (const std::exception& ex) {
@@ -230,7 +236,7 @@ namespace fgui {
 		}
 
 		if (!render) {
-			render = std::make_unique<c_renderer>(feature_level, 1);
+			render = std::make_unique<c_renderer>(process.get(), feature_level, 1);
 		}
 		
 		return hookinfo; // return the hook data containing the command queue offset and function pointers
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "fonts.h"
+#include "bc_encoder.h"
+#include "trace.h"
 
 using namespace fgui;
 using Microsoft::WRL::ComPtr;
@@ -26,6 +28,11 @@ void c_fonts::initialize(ComPtr<ID3D12Device> device) {
 
     m_descriptor_size = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     m_next_descriptor_index = 0;
+
+    m_texture_heap.initialize(device);
+
+    // enough for a 1024x1024 RGBA image with mips, grows on demand
+    m_staging.initialize(device, 8ull * 1024 * 1024);
 }
 
 std::vector<std::wstring> c_fonts::enumerate_families() const {
@@ -53,15 +60,25 @@ std::vector<std::wstring> c_fonts::enumerate_families() const {
     return out;
 }
 
+uint32_t c_fonts::allocate_descriptor() {
+    if (!m_free_descriptors.empty()) {
+        const uint32_t index = m_free_descriptors.back();
+        m_free_descriptors.pop_back();
+        return index;
+    }
+
+    if (m_next_descriptor_index >= m_max_fonts)
+        throw std::runtime_error("Exceeded texture descriptor capacity");
+
+    return m_next_descriptor_index++;
+}
+
 font_handle c_fonts::allocate_handle_for_key(const font_key& key) {
     auto it = m_key_to_handle.find(key);
     if (it != m_key_to_handle.end()) return it->second;
 
-    if (m_next_descriptor_index >= m_max_fonts)
-        throw std::runtime_error("Exceeded font capacity");
-
     // allocate a descriptor index and use it as the font_handle
-    font_handle h = static_cast<font_handle>(m_next_descriptor_index++);
+    font_handle h = static_cast<font_handle>(allocate_descriptor());
 
     m_key_to_handle.emplace(key, h);
     m_atlases.emplace(h, font_atlas{});
@@ -73,7 +90,7 @@ font_handle c_fonts::allocate_handle_for_key(const font_key& key) {
 font_handle c_fonts::get_or_create_font(const std::wstring& family,
     DWRITE_FONT_WEIGHT weight,
     DWRITE_FONT_STYLE style,
-    int size_px, bool* exists, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, frame_resource& current_frame) {
+    int size_px, bool* exists, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue) {
     font_key key{ family, weight, style, size_px };
     font_handle fh = allocate_handle_for_key(key);
 
@@ -85,7 +102,7 @@ font_handle c_fonts::get_or_create_font(const std::wstring& family,
     }
 
     // build atlas (may throw)
-    if (!build_font_atlas(fh, atlas, device, cmd_queue, current_frame)) {
+    if (!build_font_atlas(fh, atlas, device, cmd_queue)) {
         // failed to build
         std::wstring msg = L"Failed to build font atlas for " + key.family +
             L" w=" + std::to_wstring(key.weight) + L" s=" + std::to_wstring(key.style) + L" sz=" + std::to_wstring(key.size_px);
@@ -109,7 +126,9 @@ PSEUDOCODE / PLAN:
   4. Use ClearType rendering mode for sharper horizontal edges on LCDs.
 */
 
-bool c_fonts::build_font_atlas(font_handle fh, font_atlas& atlas, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, frame_resource& current_frame) {
+bool c_fonts::build_font_atlas(font_handle fh, font_atlas& atlas, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue) {
+    FGUI_TRACE_ZONE("fonts::build_font_atlas");
+
     // find family -> font -> fontface
     UINT32 index = 0;
     BOOL exists = FALSE;
@@ -246,43 +265,16 @@ bool c_fonts::build_font_atlas(font_handle fh, font_atlas& atlas, ComPtr<ID3D12D
     tex_desc.SampleDesc.Count = 1;
     tex_desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 
-    CD3DX12_HEAP_PROPERTIES default_heap(D3D12_HEAP_TYPE_DEFAULT);
-
-    if (FAILED(device->CreateCommittedResource(&default_heap, D3D12_HEAP_FLAG_NONE, &tex_desc,
-        D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&atlas.texture))))
-        throw std::runtime_error("Failed to create font texture");
-
-    // upload (simple - reuse our existing upload flow)
-    UINT64 upload_size = GetRequiredIntermediateSize(atlas.texture.Get(), 0, 1);
-
-    ComPtr<ID3D12Resource> upload;
-    CD3DX12_HEAP_PROPERTIES upload_heap(D3D12_HEAP_TYPE_UPLOAD);
-
-    CD3DX12_RESOURCE_DESC upload_desc = CD3DX12_RESOURCE_DESC::Buffer(upload_size);
-
-    if (FAILED(device->CreateCommittedResource(&upload_heap, D3D12_HEAP_FLAG_NONE, &upload_desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&upload))))
-        throw std::runtime_error("Failed to create upload buffer");
+    atlas.texture = m_texture_heap.create_texture(tex_desc, D3D12_RESOURCE_STATE_COPY_DEST, atlas.memory);
 
     D3D12_SUBRESOURCE_DATA sub{};
     sub.pData = atlas_data.data();
     sub.RowPitch = size_t(atlas_w) * 4ull;
     sub.SlicePitch = sub.RowPitch * size_t(atlas_h);
 
-    auto& cmd = current_frame.command_list;
-    cmd->Reset(current_frame.command_allocator.Get(), nullptr);
-    UpdateSubresources(cmd.Get(), atlas.texture.Get(), upload.Get(), 0, 0, 1, &sub);
-
-    CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(atlas.texture.Get(),
-        D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    cmd->ResourceBarrier(1, &barrier);
-    cmd->Close();
-
-    ID3D12CommandList* lists[] = { cmd.Get() };
-    cmd_queue->ExecuteCommandLists(1, lists);
-
-    current_frame.signal(cmd_queue);
-    current_frame.wait_for_gpu();
+    // upload through the shared staging buffer on its own command list, the frame's list is left alone
+    m_staging.upload(atlas.texture.Get(), 0, 1, &sub, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    m_staging.flush(cmd_queue);
 
     // use the font_handle value as the descriptor index (do NOT increment the descriptor counter here)
     uint32_t descriptor_index = static_cast<uint32_t>(fh);
@@ -315,27 +307,137 @@ const font_glyph_info* c_fonts::get_glyph_info(font_handle fh, uint32_t codepoin
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE c_fonts::get_font_srv_gpu(font_handle fh) const {
-    // Check font atlases first
-    auto it = m_atlases.find(fh);
-    if (it != m_atlases.end())
-        return it->second.srv_gpu;
+    // handles are descriptor indices for fonts and images alike, no lookup needed
+    if (!m_font_srv_heap || fh >= m_max_fonts)
+        return {};
 
-    // Fall back to loaded images (they share the same descriptor heap)
-    auto img_it = m_images.find(fh);
-    if (img_it != m_images.end())
-        return img_it->second.srv_gpu;
+    D3D12_GPU_DESCRIPTOR_HANDLE gpu = m_font_srv_heap->GetGPUDescriptorHandleForHeapStart();
+    gpu.ptr += SIZE_T(fh) * m_descriptor_size;
+    return gpu;
+}
 
-    return {};
+// number of levels in a full mip chain down to 1x1
+static uint32_t calc_mip_count(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    uint32_t dim = std::max(width, height);
+    while (dim > 1) {
+        dim >>= 1;
+        ++levels;
+    }
+    return levels;
+}
+
+// 2x2 box filter from src into a half-sized level. Images are stored premultiplied, so a plain
+// average of all four channels is already the correct alpha-weighted result with no dark fringes.
+// With an odd width or height the last column/row of dst also takes the leftover source texels
+// (a 3 wide footprint) instead of dropping them, and a 1 texel dimension clamps to that texel.
+static void downsample_rgba(const uint8_t* src, uint32_t src_w, uint32_t src_h,
+    uint8_t* dst, uint32_t dst_w, uint32_t dst_h) {
+
+    for (uint32_t y = 0; y < dst_h; ++y) {
+        const uint32_t y_begin = std::min(y * 2, src_h - 1);
+        const uint32_t y_end = y + 1 == dst_h ? src_h : std::min(y * 2 + 2, src_h);
+
+        for (uint32_t x = 0; x < dst_w; ++x) {
+            const uint32_t x_begin = std::min(x * 2, src_w - 1);
+            const uint32_t x_end = x + 1 == dst_w ? src_w : std::min(x * 2 + 2, src_w);
+
+            uint32_t sum[4] = {};
+            for (uint32_t sy = y_begin; sy < y_end; ++sy) {
+                const uint8_t* row = src + (size_t(sy) * src_w + x_begin) * 4ull;
+                for (uint32_t sx = x_begin; sx < x_end; ++sx, row += 4) {
+                    for (int c = 0; c < 4; ++c)
+                        sum[c] += row[c];
+                }
+            }
+
+            const uint32_t count = (y_end - y_begin) * (x_end - x_begin);
+            uint8_t* out = dst + (size_t(y) * dst_w + x) * 4ull;
+            for (int c = 0; c < 4; ++c)
+                out[c] = uint8_t((sum[c] + count / 2) / count);
+        }
+    }
 }
 
 image_handle c_fonts::load_image_rgba(const uint8_t* pixels, uint32_t width, uint32_t height,
     ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue,
-    frame_resource& current_frame) {
+    bool generate_mips, bool compress) {
     
-    if (m_next_descriptor_index >= m_max_fonts)
-        throw std::runtime_error("Exceeded texture descriptor capacity");
+    if (!pixels || width == 0 || height == 0)
+        throw std::runtime_error("Invalid image data");
+
+    const uint32_t mip_levels = generate_mips ? calc_mip_count(width, height) : 1;
+
+    struct level_view {
+        const uint8_t* data;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    // level 0 is the caller's buffer, every following level is filtered from the one before it
+    std::vector<std::vector<uint8_t>> mip_data(mip_levels - 1);
+    std::vector<level_view> levels(mip_levels);
+    levels[0] = { pixels, width, height };
+
+    for (uint32_t level = 1; level < mip_levels; ++level) {
+        const level_view& prev = levels[level - 1];
+        const uint32_t next_w = std::max(1u, prev.width / 2);
+        const uint32_t next_h = std::max(1u, prev.height / 2);
+
+        auto& dst = mip_data[level - 1];
+        dst.resize(size_t(next_w) * next_h * 4ull);
+        downsample_rgba(prev.data, prev.width, prev.height, dst.data(), next_w, next_h);
+
+        levels[level] = { dst.data(), next_w, next_h };
+    }
+
+    // block compression needs a block aligned top level, anything else stays uncompressed
+    if (compress && (width % 4 != 0 || height % 4 != 0)) {
+        std::cerr << "[flashgui] Image " << width << "x" << height << " is not a multiple of 4, uploading uncompressed\n";
+        compress = false;
+    }
+
+    DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    std::vector<std::vector<uint8_t>> blocks;
+    std::vector<D3D12_SUBRESOURCE_DATA> subs(mip_levels);
 
-    image_handle h = static_cast<image_handle>(m_next_descriptor_index++);
+    if (compress) {
+        // BC1 is half the size of BC3, only pay for the alpha block when the image needs it
+        format = bc::has_alpha(pixels, width, height) ? DXGI_FORMAT_BC3_UNORM : DXGI_FORMAT_BC1_UNORM;
+        blocks.resize(mip_levels);
+
+        for (uint32_t level = 0; level < mip_levels; ++level) {
+            const level_view& lv = levels[level];
+            blocks[level] = bc::encode_image(lv.data, lv.width, lv.height, format);
+
+            subs[level].pData = blocks[level].data();
+            subs[level].RowPitch = static_cast<LONG_PTR>(dds_image::row_pitch(format, lv.width));
+            subs[level].SlicePitch = static_cast<LONG_PTR>(dds_image::slice_pitch(format, lv.width, lv.height));
+        }
+    }
+    else {
+        for (uint32_t level = 0; level < mip_levels; ++level) {
+            const level_view& lv = levels[level];
+            subs[level].pData = lv.data;
+            subs[level].RowPitch = size_t(lv.width) * 4ull;
+            subs[level].SlicePitch = subs[level].RowPitch * size_t(lv.height);
+        }
+    }
+
+    return create_image(format, width, height, mip_levels, subs.data(), device, cmd_queue);
+}
+
+image_handle c_fonts::load_image_compressed(const dds_image& img,
+    ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue) {
+
+    // blocks go to the GPU exactly as stored, no decode and no re-encode
+    const std::vector<D3D12_SUBRESOURCE_DATA> subs = img.subresources();
+    return create_image(img.format, img.width, img.height, img.mip_levels, subs.data(), device, cmd_queue);
+}
+
+image_handle c_fonts::create_image(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mip_levels,
+    const D3D12_SUBRESOURCE_DATA* subs, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue) {
+    FGUI_TRACE_ZONE("fonts::upload_image");
 
     // Create the GPU texture
     D3D12_RESOURCE_DESC tex_desc = {};
@@ -343,58 +445,77 @@ image_handle c_fonts::load_image_rgba(const uint8_t* pixels, uint32_t width, uin
     tex_desc.Width = width;
     tex_desc.Height = height;
     tex_desc.DepthOrArraySize = 1;
-    tex_desc.MipLevels = 1;
-    tex_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    tex_desc.MipLevels = static_cast<UINT16>(mip_levels);
+    tex_desc.Format = format;
     tex_desc.SampleDesc.Count = 1;
     tex_desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 
     image_entry entry{};
     entry.width = width;
     entry.height = height;
+    entry.mip_levels = mip_levels;
+    entry.format = format;
 
-    CD3DX12_HEAP_PROPERTIES default_heap(D3D12_HEAP_TYPE_DEFAULT);
-    if (FAILED(device->CreateCommittedResource(&default_heap, D3D12_HEAP_FLAG_NONE, &tex_desc,
-        D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&entry.texture))))
-        throw std::runtime_error("Failed to create image texture");
+    entry.texture = m_texture_heap.create_texture(tex_desc, D3D12_RESOURCE_STATE_COPY_DEST, entry.memory);
 
-    // Upload via staging buffer
-    UINT64 upload_size = GetRequiredIntermediateSize(entry.texture.Get(), 0, 1);
-    ComPtr<ID3D12Resource> upload;
-    CD3DX12_HEAP_PROPERTIES upload_heap(D3D12_HEAP_TYPE_UPLOAD);
-    auto upload_desc = CD3DX12_RESOURCE_DESC::Buffer(upload_size);
-    if (FAILED(device->CreateCommittedResource(&upload_heap, D3D12_HEAP_FLAG_NONE, &upload_desc,
-        D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&upload))))
-        throw std::runtime_error("Failed to create image upload buffer");
+    try {
+        m_staging.upload(entry.texture.Get(), 0, mip_levels, subs, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        m_staging.flush(cmd_queue);
+    }
+    catch (...) {
+        entry.texture.Reset();
+        m_texture_heap.free(entry.memory);
+        throw;
+    }
 
-    D3D12_SUBRESOURCE_DATA sub{};
-    sub.pData = pixels;
-    sub.RowPitch = size_t(width) * 4ull;
-    sub.SlicePitch = sub.RowPitch * size_t(height);
+    // allocate only once the upload succeeded so a failed load doesn't leak a descriptor
+    return register_image(std::move(entry), device);
+}
 
-    auto& cmd = current_frame.command_list;
-    cmd->Reset(current_frame.command_allocator.Get(), nullptr);
-    UpdateSubresources(cmd.Get(), entry.texture.Get(), upload.Get(), 0, 0, 1, &sub);
+image_handle c_fonts::create_render_target(DXGI_FORMAT format, uint32_t width, uint32_t height, ComPtr<ID3D12Device> device) {
+    FGUI_TRACE_ZONE("fonts::create_render_target");
 
-    auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(entry.texture.Get(),
-        D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    cmd->ResourceBarrier(1, &barrier);
-    cmd->Close();
+    D3D12_RESOURCE_DESC tex_desc = {};
+    tex_desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    tex_desc.Width = width;
+    tex_desc.Height = height;
+    tex_desc.DepthOrArraySize = 1;
+    tex_desc.MipLevels = 1;
+    tex_desc.Format = format;
+    tex_desc.SampleDesc.Count = 1;
+    tex_desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    tex_desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+
+    // targets are cleared to transparent before every use
+    D3D12_CLEAR_VALUE clear{};
+    clear.Format = format;
 
-    ID3D12CommandList* lists[] = { cmd.Get() };
-    cmd_queue->ExecuteCommandLists(1, lists);
-    current_frame.signal(cmd_queue);
-    current_frame.wait_for_gpu();
+    image_entry entry{};
+    entry.width = width;
+    entry.height = height;
+    entry.format = format;
+    entry.texture = m_texture_heap.create_texture(tex_desc, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, entry.memory, &clear);
+
+    return register_image(std::move(entry), device);
+}
+
+image_handle c_fonts::register_image(image_entry&& entry, ComPtr<ID3D12Device> device) {
+    image_handle h = static_cast<image_handle>(allocate_descriptor());
 
     // Create SRV at the allocated descriptor index
     auto cpu = m_font_srv_heap->GetCPUDescriptorHandleForHeapStart();
     cpu.ptr += SIZE_T(h) * m_descriptor_size;
 
     D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc{};
-    srv_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    srv_desc.Format = entry.format;
     srv_desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-    srv_desc.Texture2D.MipLevels = 1;
+    srv_desc.Texture2D.MipLevels = entry.mip_levels;
     srv_desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 
+    // BC4 samples as (r, 0, 0, 1), the view replicates red so single channel images draw grey
+    if (entry.format == DXGI_FORMAT_BC4_UNORM || entry.format == DXGI_FORMAT_BC4_SNORM)
+        srv_desc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(0, 0, 0, D3D12_SHADER_COMPONENT_MAPPING_FORCE_VALUE_1);
+
     device->CreateShaderResourceView(entry.texture.Get(), &srv_desc, cpu);
 
     auto gpu = m_font_srv_heap->GetGPUDescriptorHandleForHeapStart();
@@ -409,4 +530,113 @@ const image_entry* c_fonts::get_image(image_handle h) const {
     auto it = m_images.find(h);
     if (it == m_images.end()) return nullptr;
     return &it->second;
-}
\ No newline at end of file
+}
+
+image_handle c_fonts::acquire_cached_image(const std::string& path_key) {
+    auto it = m_image_by_path.find(path_key);
+    return it != m_image_by_path.end() ? add_image_ref(it->second) : invalid_image;
+}
+
+image_handle c_fonts::acquire_cached_image(uint64_t content_hash, const image_source_key& source) {
+    auto it = m_image_by_hash.find(content_hash);
+    if (it == m_image_by_hash.end())
+        return invalid_image;
+
+    // a 64 bit hash can collide, different dimensions, format or bytes are a miss
+    if (!(m_images.at(it->second).source == source))
+        return invalid_image;
+
+    return add_image_ref(it->second);
+}
+
+image_handle c_fonts::add_image_ref(image_handle h) {
+    image_entry& entry = m_images.at(h);
+
+    // revive an image that was waiting for deferred release
+    if (entry.ref_count++ == 0) {
+        entry.retire_fences.clear();
+        m_released_images.erase(std::remove(m_released_images.begin(), m_released_images.end(), h), m_released_images.end());
+    }
+
+    return h;
+}
+
+void c_fonts::cache_image(image_handle h, const std::string& path_key, uint64_t content_hash, const image_source_key& source) {
+    auto it = m_images.find(h);
+    if (it == m_images.end())
+        return;
+
+    image_entry& entry = it->second;
+
+    if (!path_key.empty() && m_image_by_path.emplace(path_key, h).second)
+        entry.paths.push_back(path_key);
+
+    if (content_hash != 0 && entry.content_hash == 0 && m_image_by_hash.emplace(content_hash, h).second) {
+        entry.content_hash = content_hash;
+        entry.source = source;
+    }
+}
+
+bool c_fonts::release_image(image_handle h) {
+    auto it = m_images.find(h);
+    if (it == m_images.end() || it->second.ref_count == 0)
+        return false;
+
+    image_entry& entry = it->second;
+    if (--entry.ref_count > 0)
+        return false;
+
+    // the fences are taken by collect_released_images on the render thread, which owns them.
+    // Loader threads get here as well and can't read them while a submit is updating them
+    entry.retire_fences.clear();
+    m_released_images.push_back(h);
+    return true;
+}
+
+void c_fonts::collect_released_images(const std::vector<frame_resource>& frames, uint32_t current_frame) {
+    for (size_t r = 0; r < m_released_images.size();) {
+        const image_handle h = m_released_images[r];
+        image_entry& entry = m_images.at(h);
+
+        // released since the last collect. The frame being recorded signals fence_value + 1 once it is
+        // submitted, every other frame has already signalled everything that could have drawn this image
+        if (entry.retire_fences.empty()) {
+            entry.retire_fences.resize(frames.size());
+            for (size_t i = 0; i < frames.size(); ++i)
+                entry.retire_fences[i] = frames[i].fence_value + (i == current_frame ? 1 : 0);
+        }
+
+        bool gpu_done = true;
+        for (size_t i = 0; i < frames.size() && i < entry.retire_fences.size(); ++i) {
+            if (frames[i].fence && frames[i].fence->GetCompletedValue() < entry.retire_fences[i]) {
+                gpu_done = false;
+                break;
+            }
+        }
+
+        if (!gpu_done) {
+            ++r;
+            continue;
+        }
+
+        for (const std::string& path : entry.paths)
+            m_image_by_path.erase(path);
+
+        if (entry.content_hash != 0)
+            m_image_by_hash.erase(entry.content_hash);
+
+        // the placed resource has to go before its heap range can be handed out again
+        const texture_allocation memory = entry.memory;
+        m_images.erase(h);
+        m_texture_heap.free(memory);
+        m_free_descriptors.push_back(h);
+
+        m_released_images[r] = m_released_images.back();
+        m_released_images.pop_back();
+    }
+}
+
+uint32_t c_fonts::get_image_ref_count(image_handle h) const {
+    auto it = m_images.find(h);
+    return it != m_images.end() ? it->second.ref_count : 0;
+}
@@ -4,10 +4,14 @@
 #include <wrl/client.h>
 #include <DirectXMath.h>
 #include <string>
+#include <cstring>
 #include <vector>
 #include <unordered_map>
 
 #include "frame_resource.hpp"
+#include "dds_loader.hpp"
+#include "texture_heap.h"
+#include "upload_arena.hpp"
 using Microsoft::WRL::ComPtr;
 
 namespace fgui {
@@ -45,10 +49,45 @@ namespace fgui {
         }
     };
 
+    constexpr uint64_t fnv1a_64_seed = 0xcbf29ce484222325ull;
+
+    // FNV-1a over 64 bit words (bytes for the tail), used to dedupe image uploads by content
+    inline uint64_t fnv1a_64(const void* data, size_t size, uint64_t seed = fnv1a_64_seed) {
+        constexpr uint64_t prime = 0x100000001b3ull;
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+
+        uint64_t h = seed;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            memcpy(&word, p + i, sizeof(word));
+            h = (h ^ word) * prime;
+        }
+        for (; i < size; ++i)
+            h = (h ^ p[i]) * prime;
+
+        return h;
+    }
+
+    // what an image's content hash was computed from, a hash hit only counts when these match too
+    struct image_source_key {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t format = 0; // pixel_layout or DXGI_FORMAT of the source, whichever the loader hashed
+        uint32_t flags = 0;  // load options: mips and compression, or the DDS mip count
+        size_t bytes = 0;
+        uint64_t check = 0;  // the bytes hashed a second time, seeded with the content hash
+
+        bool operator==(const image_source_key& o) const {
+            return width == o.width && height == o.height && format == o.format && flags == o.flags && bytes == o.bytes && check == o.check;
+        }
+    };
+
     struct font_atlas {
         font_key key;
         std::unordered_map<uint32_t, font_glyph_info> glyphs;
         ComPtr<ID3D12Resource> texture;
+        texture_allocation memory;
         D3D12_GPU_DESCRIPTOR_HANDLE srv_gpu{}; // in the global heap
         int atlas_w = 0;
         int atlas_h = 0;
@@ -57,15 +96,27 @@ namespace fgui {
     // Holds a loaded image texture and its SRV
     struct image_entry {
         ComPtr<ID3D12Resource> texture;
+        texture_allocation memory;
         D3D12_GPU_DESCRIPTOR_HANDLE srv_gpu{};
         uint32_t width = 0;
         uint32_t height = 0;
+        uint32_t mip_levels = 1; // > 1 when a mip chain was generated at load time
+        DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM; // BCn when block compressed
+
+        // cache bookkeeping, the texture is released once ref_count drops to 0 and the GPU is done with it
+        uint32_t ref_count = 1;
+        uint64_t content_hash = 0;
+        image_source_key source; // set with content_hash
+        std::vector<std::string> paths; // every path key that resolves to this image
+        std::vector<UINT64> retire_fences; // per frame resource, set when ref_count hits 0
     };
 
     // Handle type for loaded images — same numeric space as font_handle
     // (they share the same descriptor heap and instance bucket array)
     using image_handle = uint16_t;
 
+    constexpr image_handle invalid_image = 0xFFFF;
+
     class c_fonts
     {
     public:
@@ -79,7 +130,7 @@ namespace fgui {
         font_handle get_or_create_font(const std::wstring& family,
                                       DWRITE_FONT_WEIGHT weight,
                                       DWRITE_FONT_STYLE style,
-                                      int size_px, bool* exists, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, frame_resource& current_frame);
+                                      int size_px, bool* exists, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue);
 
         const font_glyph_info* get_glyph_info(font_handle fh, uint32_t codepoint) const;
 
@@ -88,17 +139,65 @@ namespace fgui {
         D3D12_GPU_DESCRIPTOR_HANDLE get_font_srv_gpu(font_handle fh) const;
 
         // Image loading: returns a handle that occupies the same descriptor/bucket space as fonts
+        // pixels must be premultiplied RGBA8 (see pixel_convert.h), the shader doesn't premultiply images
+        // generate_mips builds a full box-filtered mip chain on the CPU before upload
+        // compress encodes every level to BC1 (opaque) or BC3 (with alpha) before upload
         image_handle load_image_rgba(const uint8_t* pixels, uint32_t width, uint32_t height,
             ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue,
-            frame_resource& current_frame);
+            bool generate_mips = false, bool compress = false);
+
+        // Upload pre-compressed blocks (BC1/BC3/BC4/BC7) straight from a parsed DDS file
+        // color data is expected premultiplied like every other image, parse_dds already converts straight alpha
+        image_handle load_image_compressed(const dds_image& img,
+            ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue);
+
+        // An image the GPU draws into: a single mip render target of the given format with the usual SRV at its
+        // handle, in PIXEL_SHADER_RESOURCE between uses. Released with release_image like any other image
+        image_handle create_render_target(DXGI_FORMAT format, uint32_t width, uint32_t height, ComPtr<ID3D12Device> device);
 
         // Look up a loaded image by handle
         const image_entry* get_image(image_handle h) const;
 
+        // Image cache. A hit adds a reference and returns the existing handle, a miss returns invalid_image.
+        // Images waiting for deferred release are revived by a hit instead of being uploaded again.
+        image_handle acquire_cached_image(const std::string& path_key);
+        image_handle acquire_cached_image(uint64_t content_hash, const image_source_key& source);
+
+        // register the keys a freshly loaded image can be found under, path_key may be empty
+        void cache_image(image_handle h, const std::string& path_key, uint64_t content_hash, const image_source_key& source = {});
+
+        // drop one reference, returns true when it was the last one. The texture and descriptor stay alive
+        // until every frame that could still reference them has passed its fence (see collect_released_images).
+        // Safe from any thread that holds the renderer's resource lock, it doesn't touch the frame fences.
+        bool release_image(image_handle h);
+
+        // free textures/descriptors of released images the GPU has finished with, call once per frame from the
+        // render thread. Images released since the last call get their fences here, current_frame is the frame
+        // being recorded and its pending submit counts as a use.
+        void collect_released_images(const std::vector<frame_resource>& frames, uint32_t current_frame);
+
+        uint32_t get_image_ref_count(image_handle h) const;
+
+        // placed texture memory usage/fragmentation and staging buffer usage
+        texture_heap_stats get_texture_heap_stats() const { return m_texture_heap.get_stats(); }
+        const c_upload_arena::stats& get_staging_stats() const { return m_staging.get_stats(); }
+
     private:
-        bool build_font_atlas(font_handle fh, font_atlas& atlas, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, frame_resource& current_frame);
+        bool build_font_atlas(font_handle fh, font_atlas& atlas, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue);
         font_handle allocate_handle_for_key(const font_key& key);
 
+        // reuses descriptors freed by released images before growing into the heap
+        uint32_t allocate_descriptor();
+
+        image_handle add_image_ref(image_handle h);
+
+        // creates the texture + SRV for any image format and uploads all of its mip levels
+        image_handle create_image(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mip_levels,
+            const D3D12_SUBRESOURCE_DATA* subs, ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue);
+
+        // allocates the descriptor and SRV for a created texture and takes the entry
+        image_handle register_image(image_entry&& entry, ComPtr<ID3D12Device> device);
+
         ComPtr<IDWriteFactory> m_dwrite_factory;
         ComPtr<IDWriteFontCollection> m_system_fonts;
 
@@ -109,6 +208,20 @@ namespace fgui {
         // Loaded images, keyed by the same descriptor index used as the handle
         std::unordered_map<image_handle, image_entry> m_images;
 
+        // cache lookups into m_images
+        std::unordered_map<std::string, image_handle> m_image_by_path;
+        std::unordered_map<uint64_t, image_handle> m_image_by_hash;
+
+        // images with no references left, waiting on the GPU before being freed
+        std::vector<image_handle> m_released_images;
+
+        // descriptor indices returned by freed images
+        std::vector<uint32_t> m_free_descriptors;
+
+        // atlases and images are placed into shared heaps and uploaded through one reusable staging buffer
+        c_texture_heap m_texture_heap;
+        c_upload_arena m_staging;
+
         uint32_t m_descriptor_size = 0;
 
         // descriptor allocator index (also used as the handle value)
@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "dxgicontext.h"
+
+namespace fgui {
+	struct packet_draw {
+		static constexpr uint32_t no_clip = UINT32_MAX; // full viewport
+
+		uint32_t bucket; // font/image handle
+		uint32_t clip;   // index into frame_packet::clips or no_clip
+		uint32_t start;  // first instance in frame_packet::instances
+		uint32_t count;
+		ps_family family = ps_family::generic; // pixel shader permutation the run is drawn with
+	};
+
+	// Everything one UI frame drew, in draw order. Built on the UI thread and never touched again
+	// once published, the render thread only copies the instances and replays the draws.
+	struct frame_packet {
+		uint64_t sequence = 0; // 0 = nothing published yet
+		std::vector<shape_instance> instances;
+		std::vector<packet_draw> draws;
+		std::vector<D3D12_RECT> clips;
+		vec2i cursor;               // input.mouse_pos at begin_packet, what its cursor following instances were placed for
+		bool cursor_follow = false; // it has some
+
+		// keeps capacity, packets are recycled every frame
+		void clear() {
+			sequence = 0;
+			instances.clear();
+			draws.clear();
+			clips.clear();
+			cursor = {};
+			cursor_follow = false;
+		}
+	};
+
+	// Lock-free triple buffer between one producer (UI thread) and one consumer (render thread).
+	// The producer always has a packet to write and the consumer always has the newest complete one,
+	// neither side ever waits on the other. Packets the consumer never got to are simply overwritten.
+	class c_packet_exchange {
+	public:
+		// producer: packet to build into
+		frame_packet& back() { return m_packets[m_back]; }
+
+		// producer: hand back() over as the newest packet
+		void publish() {
+			const uint32_t old = m_ready.exchange(m_back | fresh_bit, std::memory_order_acq_rel);
+			m_back = old & index_mask;
+		}
+
+		// consumer: newest published packet, the previous one again when nothing new arrived
+		const frame_packet& acquire() {
+			if (m_ready.load(std::memory_order_relaxed) & fresh_bit) {
+				const uint32_t old = m_ready.exchange(m_front, std::memory_order_acq_rel);
+				m_front = old & index_mask;
+			}
+			return m_packets[m_front];
+		}
+
+	private:
+		static constexpr uint32_t fresh_bit = 4;
+		static constexpr uint32_t index_mask = 3;
+
+		frame_packet m_packets[3];
+		std::atomic<uint32_t> m_ready{ 1 }; // middle buffer index, fresh_bit once the producer published it
+		uint32_t m_back = 0;  // producer only
+		uint32_t m_front = 2; // consumer only
+	};
+}
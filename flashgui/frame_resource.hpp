@@ -2,6 +2,8 @@
 #include <wrl.h>
 #include <d3d12.h>
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 using Microsoft::WRL::ComPtr;
 
@@ -23,32 +25,73 @@ namespace fgui {
 
 		D3D12_GPU_VIRTUAL_ADDRESS upload_gpu_base = 0;
 
+		// heaps and buffers replaced while this frame is recorded, its commands still read them until the fence passes
+		std::vector<ComPtr<ID3D12Resource>> retired_buffers;
+
+		// glyph instances written by the text run compute pass, grown on demand (default heap, UAV)
+		ComPtr<ID3D12Resource> text_instances;
+		size_t text_capacity = 0;
+
+		// tile path (tiles.hlsl): per tile counts + lists, and the packed RGBA8 pixels it composites from
+		ComPtr<ID3D12Resource> tile_bins;
+		size_t tile_bins_capacity = 0;
+		ComPtr<ID3D12Resource> tile_pixels;
+		size_t tile_pixels_capacity = 0;
+
+		// clip culling (cull.hlsl): the visible instances, at the same offsets their upload heap copy has, and
+		// 20 byte ExecuteIndirect argument slots handed out from cull_args_cursor
+		ComPtr<ID3D12Resource> cull_instances;
+		size_t cull_instances_capacity = 0;
+		ComPtr<ID3D12Resource> cull_args;
+		uint32_t cull_args_slots = 0;
+		uint32_t cull_args_cursor = 0;
+
+		// for replacing a buffer the open list may already use, it lives until this frame's fence passes
+		void retire(ComPtr<ID3D12Resource>& buffer) {
+			if (buffer)
+				retired_buffers.push_back(std::move(buffer));
+		}
+
 		static inline size_t align_up(size_t v, size_t a) { return (v + (a - 1)) & ~(a - 1); }
 
-		void reset_upload_cursor() { upload_cursor = 0; }
+		// only after the fence wait, that's when the retired buffers are free
+		void reset_upload_cursor() {
+			upload_cursor = 0;
+			cull_args_cursor = 0;
+			retired_buffers.clear();
+		}
 
-		// push a constant buffer (returns GPU VA), 256B-aligned
-		D3D12_GPU_VIRTUAL_ADDRESS push_cb(const void* data, size_t size_bytes) {
+		// offset of size_bytes in the upload heap. When it doesn't fit the heap is replaced by one at least twice
+		// as large, upload_ptr/upload_gpu_base change then, addresses taken before stay valid for this frame
+		size_t reserve_upload(size_t size_bytes, size_t alignment = 16) {
+			size_t off = align_up(upload_cursor, alignment);
 
-			const size_t off = align_up(upload_cursor, 256);
+			if (off + size_bytes > upload_size) {
+				ComPtr<ID3D12Device> device;
+				if (FAILED(upload_heap->GetDevice(IID_PPV_ARGS(&device))))
+					throw std::runtime_error("Upload heap out of space");
+
+				retire(upload_heap);
+				create_upload_heap(device, std::max(upload_size * 2, align_up(size_bytes, 64 * 1024)));
+				off = 0;
+			}
+
+			upload_cursor = off + size_bytes;
+			return off;
+		}
 
-			if (off + size_bytes > upload_size)
-				throw std::runtime_error("Upload heap out of space for CB");
+		// push a constant buffer (returns GPU VA), 256B-aligned
+		D3D12_GPU_VIRTUAL_ADDRESS push_cb(const void* data, size_t size_bytes) {
 
+			const size_t off = reserve_upload(align_up(size_bytes, 256), 256);
 			memcpy(upload_ptr + off, data, size_bytes);
 
-			upload_cursor = off + align_up(size_bytes, 256);
 			return upload_gpu_base + off;
 		}
 
 		D3D12_GPU_VIRTUAL_ADDRESS push_bytes(const void* data, size_t size_bytes, size_t alignment = 16) {
-			const size_t off = align_up(upload_cursor, alignment);
-
-			if (off + size_bytes > upload_size)
-				throw std::runtime_error("Upload heap out of space");
-
+			const size_t off = reserve_upload(size_bytes, alignment);
 			memcpy(upload_ptr + off, data, size_bytes);
-			upload_cursor = off + size_bytes;
 
 			return upload_gpu_base + off;
 		}
@@ -127,6 +170,21 @@ namespace fgui {
 			
 			upload_heap.Reset();
 			upload_ptr = nullptr;
+			retired_buffers.clear();
+
+			text_instances.Reset();
+			text_capacity = 0;
+
+			tile_bins.Reset();
+			tile_bins_capacity = 0;
+			tile_pixels.Reset();
+			tile_pixels_capacity = 0;
+
+			cull_instances.Reset();
+			cull_instances_capacity = 0;
+			cull_args.Reset();
+			cull_args_slots = 0;
+			cull_args_cursor = 0;
 
 			fence.Reset();
 			fence_value = 0;
@@ -142,6 +200,11 @@ namespace fgui {
 			command_list->Reset(command_allocator.Get(), pso.Get());
 		}
 
+		// true once the GPU is past the last signal, the allocator can be reset then
+		bool is_complete() const {
+			return !fence || fence->GetCompletedValue() >= fence_value;
+		}
+
 		void wait_for_gpu() const {
 			if (fence && fence->GetCompletedValue() < fence_value) {
 				fence->SetEventOnCompletion(fence_value, fence_event);
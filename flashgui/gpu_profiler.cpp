@@ -0,0 +1,270 @@
+#include "pch.h"
+#include "gpu_profiler.h"
+#include <cmath>
+
+using namespace fgui;
+
+uint32_t c_rolling_histogram::bin_of(double us) {
+	if (us <= 0.0)
+		return 0;
+
+	const double bin = us / bin_us;
+	return bin >= double(bin_count - 1) ? bin_count - 1 : static_cast<uint32_t>(bin);
+}
+
+void c_rolling_histogram::add(double us) {
+	if (m_count == window)
+		m_bins[m_ring[m_head]]--;
+	else
+		m_count++;
+
+	const uint32_t bin = bin_of(us);
+	m_bins[bin]++;
+	m_ring[m_head] = bin;
+	m_head = (m_head + 1) % window;
+}
+
+void c_rolling_histogram::clear() {
+	std::fill(m_bins.begin(), m_bins.end(), 0u);
+	m_head = 0;
+	m_count = 0;
+}
+
+double c_rolling_histogram::percentile(double p) const {
+	if (!m_count)
+		return 0.0;
+
+	// rank of the sample we want, 1 based
+	const uint32_t rank = std::max(1u, static_cast<uint32_t>(std::ceil(std::clamp(p, 0.0, 1.0) * m_count)));
+
+	uint32_t seen = 0;
+	for (uint32_t i = 0; i < bin_count; ++i) {
+		seen += m_bins[i];
+		if (seen >= rank)
+			return (i + 1) * bin_us;
+	}
+
+	return bin_count * bin_us;
+}
+
+void c_gpu_profiler::initialize(ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, uint32_t slot_count) {
+	release();
+
+	// copy queues need a feature check for timestamps, the overlay always records on a direct queue
+	if (FAILED(cmd_queue->GetTimestampFrequency(&m_frequency)) || !m_frequency) {
+		OutputDebugStringA("[flashgui] Timestamp frequency unavailable, GPU timing disabled\n");
+		return;
+	}
+
+	D3D12_QUERY_HEAP_DESC heap_desc{};
+	heap_desc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+	heap_desc.Count = slot_count * queries_per_slot;
+
+	if (FAILED(device->CreateQueryHeap(&heap_desc, IID_PPV_ARGS(&m_query_heap))))
+		throw std::runtime_error("Failed to create timestamp query heap");
+
+	CD3DX12_HEAP_PROPERTIES readback_props(D3D12_HEAP_TYPE_READBACK);
+	auto desc = CD3DX12_RESOURCE_DESC::Buffer(uint64_t(heap_desc.Count) * sizeof(uint64_t));
+
+	if (FAILED(device->CreateCommittedResource(&readback_props, D3D12_HEAP_FLAG_NONE, &desc,
+		D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&m_readback))))
+		throw std::runtime_error("Failed to create timestamp readback buffer");
+
+	// readback buffers may stay mapped, slots are only read once their fence has passed
+	if (FAILED(m_readback->Map(0, nullptr, reinterpret_cast<void**>(&m_mapped))))
+		throw std::runtime_error("Failed to map timestamp readback buffer");
+
+	// optional, the timestamps work without it
+	D3D12_QUERY_HEAP_DESC stats_desc{};
+	stats_desc.Type = D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS;
+	stats_desc.Count = slot_count;
+
+	auto stats_buffer = CD3DX12_RESOURCE_DESC::Buffer(uint64_t(slot_count) * sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS));
+
+	if (FAILED(device->CreateQueryHeap(&stats_desc, IID_PPV_ARGS(&m_stats_heap))) ||
+		FAILED(device->CreateCommittedResource(&readback_props, D3D12_HEAP_FLAG_NONE, &stats_buffer,
+			D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&m_stats_readback))) ||
+		FAILED(m_stats_readback->Map(0, nullptr, reinterpret_cast<void**>(&m_stats_mapped)))) {
+		OutputDebugStringA("[flashgui] Pipeline statistics queries unavailable\n");
+		m_stats_mapped = nullptr;
+		m_stats_readback.Reset();
+		m_stats_heap.Reset();
+	}
+
+	m_slots.assign(slot_count, {});
+}
+
+void c_gpu_profiler::release() {
+	if (m_readback && m_mapped) {
+		D3D12_RANGE written{ 0, 0 };
+		m_readback->Unmap(0, &written);
+	}
+
+	m_mapped = nullptr;
+	m_readback.Reset();
+	m_query_heap.Reset();
+
+	if (m_stats_readback && m_stats_mapped) {
+		D3D12_RANGE written{ 0, 0 };
+		m_stats_readback->Unmap(0, &written);
+	}
+
+	m_stats_mapped = nullptr;
+	m_stats_readback.Reset();
+	m_stats_heap.Reset();
+	m_slots.clear();
+}
+
+void c_gpu_profiler::collect(uint32_t slot) {
+	slot_state& s = m_slots[slot];
+	if (!s.pending)
+		return;
+
+	s.pending = false;
+
+	const uint64_t* ts = m_mapped + uint64_t(slot) * queries_per_slot;
+	const double to_us = 1'000'000.0 / double(m_frequency);
+
+	// query 0 is the frame start, 1 the frame end, batches follow in begin/end pairs
+	frame_timing& t = s.timing;
+	t.gpu_us = ts[1] > ts[0] ? double(ts[1] - ts[0]) * to_us : 0.0;
+
+	for (size_t i = 0; i < t.batches.size(); ++i) {
+		const uint64_t begin = ts[2 + i * 2];
+		const uint64_t end = ts[3 + i * 2];
+		t.batches[i].gpu_us = end > begin ? double(end - begin) * to_us : 0.0;
+	}
+
+	if (s.stats_pending) {
+		const D3D12_QUERY_DATA_PIPELINE_STATISTICS& stats = m_stats_mapped[slot];
+		t.ps_invocations = stats.PSInvocations;
+		t.primitives = stats.CPrimitives;
+		s.stats_pending = false;
+	}
+
+	m_gpu_hist.add(t.gpu_us);
+	m_record_hist.add(t.cpu_record_us);
+	m_submit_hist.add(t.cpu_submit_us);
+
+	m_last = t;
+}
+
+void c_gpu_profiler::begin_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd, uint64_t frame) {
+	if (!m_query_heap || slot >= m_slots.size())
+		return;
+
+	collect(slot);
+
+	slot_state& s = m_slots[slot];
+	s.timing.frame = frame;
+	s.timing.gpu_us = 0.0;
+	s.timing.cpu_record_us = 0.0;
+	s.timing.cpu_submit_us = 0.0;
+	s.timing.dropped_batches = 0;
+	s.timing.ps_invocations = 0;
+	s.timing.primitives = 0;
+	s.timing.batches.clear();
+	s.in_batch = false;
+	s.in_stats = false;
+	s.stats_pending = false;
+	s.query_count = 0;
+
+	if (!m_enabled)
+		return;
+
+	cmd->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, slot * queries_per_slot);
+
+	if (m_pipeline_stats && m_stats_heap) {
+		cmd->BeginQuery(m_stats_heap.Get(), D3D12_QUERY_TYPE_PIPELINE_STATISTICS, slot);
+		s.in_stats = true;
+	}
+
+	// query 1 is written by end_frame
+	s.query_count = 2;
+}
+
+void c_gpu_profiler::begin_batch(uint32_t slot, ID3D12GraphicsCommandList* cmd, uint32_t bucket, uint32_t instances) {
+	if (!m_per_batch || !m_query_heap || slot >= m_slots.size())
+		return;
+
+	slot_state& s = m_slots[slot];
+	if (!s.query_count)
+		return;
+
+	if (s.query_count + 2 > queries_per_slot) {
+		s.timing.dropped_batches++;
+		return;
+	}
+
+	cmd->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, slot * queries_per_slot + s.query_count);
+	s.timing.batches.push_back({ bucket, instances, 0.0 });
+	s.in_batch = true;
+}
+
+void c_gpu_profiler::end_batch(uint32_t slot, ID3D12GraphicsCommandList* cmd) {
+	if (!m_query_heap || slot >= m_slots.size())
+		return;
+
+	slot_state& s = m_slots[slot];
+	if (!s.in_batch)
+		return;
+
+	cmd->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, slot * queries_per_slot + s.query_count + 1);
+	s.query_count += 2;
+	s.in_batch = false;
+}
+
+void c_gpu_profiler::end_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd, double cpu_record_us) {
+	if (!m_query_heap || slot >= m_slots.size())
+		return;
+
+	slot_state& s = m_slots[slot];
+	s.timing.cpu_record_us = cpu_record_us;
+
+	if (!s.query_count)
+		return;
+
+	const uint32_t base = slot * queries_per_slot;
+	cmd->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, base + 1);
+	cmd->ResolveQueryData(m_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, base, s.query_count,
+		m_readback.Get(), uint64_t(base) * sizeof(uint64_t));
+
+	if (s.in_stats) {
+		cmd->EndQuery(m_stats_heap.Get(), D3D12_QUERY_TYPE_PIPELINE_STATISTICS, slot);
+		cmd->ResolveQueryData(m_stats_heap.Get(), D3D12_QUERY_TYPE_PIPELINE_STATISTICS, slot, 1,
+			m_stats_readback.Get(), uint64_t(slot) * sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS));
+		s.in_stats = false;
+		s.stats_pending = true;
+	}
+
+	s.pending = true;
+}
+
+void c_gpu_profiler::skip_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd) {
+	if (!m_query_heap || slot >= m_slots.size())
+		return;
+
+	slot_state& s = m_slots[slot];
+
+	// a begun query has to be ended before Close even if the list never runs
+	if (s.in_stats)
+		cmd->EndQuery(m_stats_heap.Get(), D3D12_QUERY_TYPE_PIPELINE_STATISTICS, slot);
+
+	s.in_stats = false;
+	s.in_batch = false;
+	s.query_count = 0;
+}
+
+void c_gpu_profiler::set_submit_time(uint32_t slot, double cpu_submit_us) {
+	if (slot < m_slots.size())
+		m_slots[slot].timing.cpu_submit_us = cpu_submit_us;
+}
+
+frame_time_percentiles c_gpu_profiler::get_percentiles() const {
+	frame_time_percentiles out{};
+	out.gpu = m_gpu_hist.percentiles();
+	out.cpu_record = m_record_hist.percentiles();
+	out.cpu_submit = m_submit_hist.percentiles();
+	out.samples = m_gpu_hist.size();
+	return out;
+}
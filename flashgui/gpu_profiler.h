@@ -0,0 +1,133 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	struct batch_timing {
+		uint32_t bucket = 0;    // font/image handle the batch drew with
+		uint32_t instances = 0;
+		double gpu_us = 0.0;
+	};
+
+	// everything measured for one frame, GPU numbers arrive a few frames after it was recorded
+	struct frame_timing {
+		uint64_t frame = 0;
+		double gpu_us = 0.0;        // first to last command of the overlay's command list
+		double cpu_record_us = 0.0; // begin_frame (after waiting) until the list is closed
+		double cpu_submit_us = 0.0; // ExecuteCommandLists + Present
+		uint32_t dropped_batches = 0; // batches past the per frame query budget, not timed
+		uint64_t ps_invocations = 0;  // pixels shaded, with pipeline statistics on (overdraw included)
+		uint64_t primitives = 0;      // triangles that reached the rasterizer
+		std::vector<batch_timing> batches;
+	};
+
+	struct time_percentiles {
+		double p50 = 0.0;
+		double p95 = 0.0;
+		double p99 = 0.0;
+	};
+
+	struct frame_time_percentiles {
+		time_percentiles gpu;
+		time_percentiles cpu_record;
+		time_percentiles cpu_submit;
+		uint32_t samples = 0;
+	};
+
+	// Fixed bin histogram over the last window samples. Adding a sample moves the oldest one out,
+	// so percentiles are a scan over the bins instead of a sort.
+	class c_rolling_histogram {
+	public:
+		static constexpr uint32_t window = 512;
+		static constexpr double bin_us = 5.0;
+		static constexpr uint32_t bin_count = 10000; // 50ms, slower samples land in the last bin
+
+		c_rolling_histogram() : m_bins(bin_count, 0) {}
+
+		void add(double us);
+		void clear();
+
+		// p in [0, 1], returns the upper edge of the bin the percentile falls into
+		double percentile(double p) const;
+		time_percentiles percentiles() const { return { percentile(0.50), percentile(0.95), percentile(0.99) }; }
+
+		uint32_t size() const { return m_count; }
+
+	private:
+		static uint32_t bin_of(double us);
+
+		std::vector<uint32_t> m_bins;
+		uint32_t m_ring[window] = {};
+		uint32_t m_head = 0;
+		uint32_t m_count = 0;
+	};
+
+	// Timestamp queries around the overlay's command list. Each frame resource gets its own slice of the
+	// query heap and readback buffer, results are read when the slot comes around again and its fence
+	// has passed, so reading never stalls. Pipeline statistics (pixel shader invocations) are an optional
+	// second query per slot over the same span.
+	class c_gpu_profiler {
+	public:
+		static constexpr uint32_t max_batches_per_frame = 255;
+		static constexpr uint32_t queries_per_slot = 2 + max_batches_per_frame * 2;
+
+		void initialize(ComPtr<ID3D12Device> device, ComPtr<ID3D12CommandQueue> cmd_queue, uint32_t slot_count);
+		void release();
+
+		void set_enabled(bool enabled, bool per_batch, bool pipeline_stats = false) {
+			m_enabled = enabled; m_per_batch = per_batch; m_pipeline_stats = pipeline_stats;
+		}
+		bool enabled() const { return m_enabled && m_query_heap; }
+
+		// the slot's previous frame must be complete on the GPU, begin_frame reads its results first
+		void begin_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd, uint64_t frame);
+		void begin_batch(uint32_t slot, ID3D12GraphicsCommandList* cmd, uint32_t bucket, uint32_t instances);
+		void end_batch(uint32_t slot, ID3D12GraphicsCommandList* cmd);
+
+		// writes the last timestamp and resolves the slot into the readback buffer, call before Close
+		void end_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd, double cpu_record_us);
+		void set_submit_time(uint32_t slot, double cpu_submit_us);
+
+		// the list is closed without running, ends the open statistics query and forgets the slot's results
+		void skip_frame(uint32_t slot, ID3D12GraphicsCommandList* cmd);
+
+		const frame_timing& get_last_frame() const { return m_last; }
+		frame_time_percentiles get_percentiles() const;
+
+	private:
+		struct slot_state {
+			uint32_t query_count = 0;
+			bool pending = false; // resolved but not read back yet
+			bool in_batch = false;
+			bool in_stats = false; // pipeline statistics query begun, not ended yet
+			bool stats_pending = false;
+			frame_timing timing;
+		};
+
+		void collect(uint32_t slot);
+
+		ComPtr<ID3D12QueryHeap> m_query_heap;
+		ComPtr<ID3D12Resource> m_readback;
+		uint64_t* m_mapped = nullptr;
+
+		ComPtr<ID3D12QueryHeap> m_stats_heap;
+		ComPtr<ID3D12Resource> m_stats_readback;
+		D3D12_QUERY_DATA_PIPELINE_STATISTICS* m_stats_mapped = nullptr;
+		uint64_t m_frequency = 0;
+
+		std::vector<slot_state> m_slots;
+		frame_timing m_last;
+
+		c_rolling_histogram m_gpu_hist;
+		c_rolling_histogram m_record_hist;
+		c_rolling_histogram m_submit_hist;
+
+		bool m_enabled = true;
+		bool m_per_batch = false;
+		bool m_pipeline_stats = false;
+	};
+}
@@ -6,6 +6,27 @@
 
 namespace fgui {
 
+	// A window (or none) with its input and the renderer drawing for it. Instances share nothing, each has its own
+	// device, fonts and pipelines and is used from one thread at a time, so several can run side by side
+	struct instance {
+		std::unique_ptr<c_process> process;
+		std::unique_ptr<c_renderer> render; // draws for process, declared after it so it is destroyed first
+	};
+
+	/*
+	* @param buffer_count - swapchain buffers, also the frames in flight.
+	* @brief Standalone window with its own renderer, the globals below are left alone.
+	* @throws std::runtime_error if the window cannot be created.
+	*/
+	instance create_instance(UINT buffer_count = 4);
+
+	/*
+	* @param size - size of the offscreen targets, c_process::resize changes it.
+	* @param buffer_count - targets, also the frames in flight.
+	* @brief No window or swapchain, frames are drawn into offscreen targets and read with capture_frame/read_frame.
+	*/
+	instance create_headless(vec2i size, UINT buffer_count = 2);
+
 	/*
 	* @param swapchain - pointer to IDXGISwapChain3, can be nullptr.
 	* @param command_queue - pointer to ID3D12CommandQueue, can be nullptr.
@@ -46,6 +67,7 @@ namespace fgui {
 		extern hook_data hookinfo; // Only need for command queue offset
 	}
 
+	// the instance the initialize overloads create, for code written against a single renderer
 	extern std::unique_ptr<c_renderer> render;
 	extern std::unique_ptr<c_process> process; // Information about the target process
 }
\ No newline at end of file
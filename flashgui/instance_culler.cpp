@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "instance_culler.h"
+#include "dxgicontext.h"
+#include "redraw_tracker.h"
+#include "trace.h"
+#include <algorithm>
+
+using namespace fgui;
+
+size_t fgui::cull_instances(std::vector<shape_instance>& instances, const RECT& clip) {
+	const size_t before = instances.size();
+
+	// cursor following instances only get their final position on the GPU
+	auto outside = [&](const shape_instance& inst) {
+		if (inst.shape_type & cursor_relative_flag)
+			return false;
+
+		const RECT r = c_redraw_tracker::bounds_of(inst);
+		return r.right <= clip.left || r.left >= clip.right || r.bottom <= clip.top || r.top >= clip.bottom;
+	};
+	instances.erase(std::remove_if(instances.begin(), instances.end(), outside), instances.end());
+
+	return before - instances.size();
+}
+
+void c_instance_culler::reset() {
+	m_root_sig.Reset();
+	m_pso.Reset();
+	for (auto& sig : m_command_sigs)
+		sig.Reset();
+}
+
+void c_instance_culler::create(s_dxgicontext& dx) {
+	reset();
+
+	// optional, flush culls on the CPU if it fails
+	try {
+		// b0 clip + draw, t0 instances, u0 visible instances, u1 draw arguments (see cull.hlsl)
+		m_root_sig = c_rootsig_builder(dx.device)
+			.add_constants(0, 8, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_srv(0, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(0, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(1, D3D12_SHADER_VISIBILITY_ALL)
+			.set_flags(D3D12_ROOT_SIGNATURE_FLAG_NONE)
+			.build("fgui_cull_root_sig");
+
+		D3D12_COMPUTE_PIPELINE_STATE_DESC desc{};
+		desc.pRootSignature = m_root_sig.Get();
+		desc.CS = { dx.shaders->get_cs_cull_blob()->GetBufferPointer(), dx.shaders->get_cs_cull_blob()->GetBufferSize() };
+
+		m_pso = dx.pipeline_cache.get_or_create(L"fgui_pso_cull", desc);
+		if (!m_pso)
+			throw std::runtime_error("Failed to create compute pipeline state");
+		m_pso->SetName(L"fgui_pso_cull");
+
+		// input assembler: DrawIndexedInstanced with the chunk's start as StartInstanceLocation
+		D3D12_INDIRECT_ARGUMENT_DESC draw_indexed{};
+		draw_indexed.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+		D3D12_COMMAND_SIGNATURE_DESC sig_desc{};
+		sig_desc.ByteStride = cull_args_stride;
+		sig_desc.NumArgumentDescs = 1;
+		sig_desc.pArgumentDescs = &draw_indexed;
+
+		HRESULT hr = dx.device->CreateCommandSignature(&sig_desc, nullptr, IID_PPV_ARGS(&m_command_sigs[size_t(vertex_path::input_assembler)]));
+		if (FAILED(hr))
+			throw std::runtime_error("CreateCommandSignature failed, HRESULT: " + std::to_string(hr));
+
+		// vertex pulling: SV_InstanceID doesn't include StartInstanceLocation, the chunk's start goes to
+		// instance_base (root parameter 2) before each DrawInstanced
+		if (dx.root_sig_pull) {
+			D3D12_INDIRECT_ARGUMENT_DESC pull_args[2]{};
+			pull_args[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+			pull_args[0].Constant.RootParameterIndex = 2;
+			pull_args[0].Constant.DestOffsetIn32BitValues = 0;
+			pull_args[0].Constant.Num32BitValuesToSet = 1;
+			pull_args[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+
+			sig_desc.NumArgumentDescs = 2;
+			sig_desc.pArgumentDescs = pull_args;
+
+			hr = dx.device->CreateCommandSignature(&sig_desc, dx.root_sig_pull.Get(), IID_PPV_ARGS(&m_command_sigs[size_t(vertex_path::vertex_pulling)]));
+			if (FAILED(hr))
+				throw std::runtime_error("CreateCommandSignature (pull) failed, HRESULT: " + std::to_string(hr));
+		}
+	}
+	catch (const std::exception& ex) {
+		std::string msg = "Failed to create cull pipeline: ";
+		msg += ex.what();
+		msg += "\n";
+		OutputDebugStringA(msg.c_str());
+		std::cerr << msg;
+
+		reset();
+	}
+}
+
+void c_instance_culler::begin_frame() {
+	m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+	m_args_state = D3D12_RESOURCE_STATE_COMMON;
+}
+
+uint32_t c_instance_culler::cull(s_dxgicontext& dx, D3D12_GPU_VIRTUAL_ADDRESS instances, size_t heap_offset, size_t bytes, size_t first_draw, const RECT& clip) {
+	FGUI_TRACE_ZONE("dx::cull_draws");
+
+	frame_resource& fr = dx.get_current_frame_resource();
+	auto& cmd = fr.command_list;
+
+	auto transition = [&](ID3D12Resource* resource, D3D12_RESOURCE_STATES& state, D3D12_RESOURCE_STATES to) {
+		if (state == to)
+			return;
+		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(resource, state, to);
+		cmd->ResourceBarrier(1, &barrier);
+		state = to;
+	};
+
+	uint32_t slots = 0;
+	for (size_t d = first_draw; d < dx.draw_stack.size(); d++)
+		slots += (dx.draw_stack[d].count + cull_chunk - 1) / cull_chunk;
+
+	// the visible instances mirror the upload heap, so it's sized like it. Draws of earlier flushes may still
+	// read the buffers being replaced
+	if (fr.cull_instances_capacity < heap_offset + bytes) {
+		fr.retire(fr.cull_instances);
+		fr.cull_instances = dx.create_uav_buffer(fr.upload_size, L"fgui_cull_instances");
+		fr.cull_instances_capacity = fr.upload_size;
+		m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+	}
+	if (fr.cull_args_cursor + slots > fr.cull_args_slots) {
+		const uint32_t capacity = std::max({ fr.cull_args_slots * 2, slots, 4096u });
+		fr.retire(fr.cull_args);
+		fr.cull_args = dx.create_uav_buffer(size_t(capacity) * cull_args_stride, L"fgui_cull_args");
+		fr.cull_args_slots = capacity;
+		fr.cull_args_cursor = 0;
+		m_args_state = D3D12_RESOURCE_STATE_COMMON;
+	}
+
+	const uint32_t first_slot = fr.cull_args_cursor;
+	fr.cull_args_cursor += slots;
+
+	// the previous flush's draws are done reading both once they're back in UAV state
+	transition(fr.cull_instances.Get(), m_instances_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	transition(fr.cull_args.Get(), m_args_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+	cmd->SetComputeRootSignature(m_root_sig.Get());
+	cmd->SetPipelineState(m_pso.Get());
+	cmd->SetComputeRootShaderResourceView(1, instances);
+	cmd->SetComputeRootUnorderedAccessView(2, fr.cull_instances->GetGPUVirtualAddress() + heap_offset);
+	cmd->SetComputeRootUnorderedAccessView(3, fr.cull_args->GetGPUVirtualAddress());
+
+	struct {
+		int32_t left, top, right, bottom;
+		uint32_t first_instance, instance_count, first_slot, pull_layout;
+	} constants;
+	constants.left = clip.left;
+	constants.top = clip.top;
+	constants.right = clip.right;
+	constants.bottom = clip.bottom;
+	constants.pull_layout = dx.frame_path == vertex_path::vertex_pulling ? 1 : 0;
+
+	// one group per chunk, a draw too long for one Dispatch continues in the next with the following slots
+	constexpr uint32_t max_instances = D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION * cull_chunk;
+	uint32_t slot = first_slot;
+
+	for (size_t d = first_draw; d < dx.draw_stack.size(); d++) {
+		for (uint32_t done = 0; done < dx.draw_stack[d].count; ) {
+			const uint32_t count = std::min(dx.draw_stack[d].count - done, max_instances);
+			const uint32_t chunks = (count + cull_chunk - 1) / cull_chunk;
+
+			constants.first_instance = dx.draw_stack[d].start + done;
+			constants.instance_count = count;
+			constants.first_slot = slot;
+			cmd->SetComputeRoot32BitConstants(0, 8, &constants, 0);
+			cmd->Dispatch(chunks, 1, 1);
+
+			slot += chunks;
+			done += count;
+		}
+	}
+
+	// read as instances (vertex buffer or root SRV) and as ExecuteIndirect arguments
+	transition(fr.cull_instances.Get(), m_instances_state, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+	transition(fr.cull_args.Get(), m_args_state, D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+	dx.bound_pso = m_pso.Get();
+
+	return first_slot;
+}
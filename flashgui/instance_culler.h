@@ -0,0 +1,53 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	struct shape_instance;
+	struct s_dxgicontext;
+
+	// how flush skips instances outside the active clip (clip_rect within the viewport)
+	enum class cull_mode {
+		off,
+		cpu, // removed before packing, they're never uploaded
+		gpu  // uploaded as recorded, cull.hlsl compacts the visible ones and writes the draws for ExecuteIndirect
+	};
+
+	// instances per cull.hlsl thread group, CULL_CHUNK there. Every chunk gets one indirect draw
+	constexpr uint32_t cull_chunk = 256;
+	constexpr uint32_t cull_args_stride = 20; // bytes per argument slot, both command signatures
+
+	// Removes the instances whose bounds (c_redraw_tracker::bounds_of) miss clip, the others keep their order.
+	// Returns how many were removed.
+	size_t cull_instances(std::vector<shape_instance>& instances, const RECT& clip);
+
+	// The GPU cull pass: cull.hlsl compacts the visible instances of each draw into the frame resource's
+	// cull_instances and writes one indirect draw per chunk into its cull_args
+	class c_instance_culler {
+	public:
+		void create(s_dxgicontext& dx); // optional, leaves the culler unavailable on failure
+		bool available() const { return m_pso != nullptr; }
+
+		// ExecuteIndirect signature per vertex_path, null when the pass can't draw that path
+		ID3D12CommandSignature* command_signature(size_t path) const { return m_command_sigs[path].Get(); }
+
+		void begin_frame(); // buffers decay to common between ExecuteCommandLists
+
+		// cull.hlsl over dx.draw_stack[first_draw..], returns the first argument slot. Each draw then takes
+		// cull_chunk-sized slots in order, the compacted instances are at fr.cull_instances + heap_offset
+		uint32_t cull(s_dxgicontext& dx, D3D12_GPU_VIRTUAL_ADDRESS instances, size_t heap_offset, size_t bytes, size_t first_draw, const RECT& clip);
+
+	private:
+		void reset();
+
+		ComPtr<ID3D12RootSignature> m_root_sig;
+		ComPtr<ID3D12PipelineState> m_pso;
+		ComPtr<ID3D12CommandSignature> m_command_sigs[2]; // the pulling one sets instance_base
+		D3D12_RESOURCE_STATES m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+		D3D12_RESOURCE_STATES m_args_state = D3D12_RESOURCE_STATE_COMMON;
+	};
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+#include "static_layer.hpp"
+#include "fonts.h"
+
+namespace fgui {
+	using panel_handle = uint32_t;
+
+	// Draws that are expensive but change rarely (charts, long lists). Recorded like a static layer, in panel
+	// space, rendered into an offscreen target of the panel's size whenever the recording changes, and drawn
+	// as one image quad every frame in between.
+	struct offscreen_panel {
+		static_layer layer;   // the recorded draws, the target is rendered from its bundles
+		vec2i size;           // what begin_panel asked for
+		bool rendered = false; // target holds the layer's current draws
+
+		// GPU side, owned by s_dxgicontext
+		image_handle target = invalid_image; // render target texture, drawn through the image path
+		vec2i target_size;                   // size target was created at, a new one is made when size differs
+		ComPtr<ID3D12DescriptorHeap> rtv_heap; // one RTV, recorded into the list by value so it can be rewritten
+	};
+}
@@ -0,0 +1,330 @@
+#include "pch.h"
+#include "pipeline_cache.h"
+#include "trace.h"
+#include "fonts.h"
+#include <cstring>
+#include <cwchar>
+#include <atomic>
+
+using namespace fgui;
+
+namespace {
+	void log_error(const std::string& msg) {
+		OutputDebugStringA(msg.c_str());
+		std::cerr << msg;
+	}
+}
+
+std::string c_pipeline_cache::default_path() {
+	char buf[MAX_PATH]{};
+	DWORD len = GetEnvironmentVariableA("LOCALAPPDATA", buf, MAX_PATH);
+	if (!len || len >= MAX_PATH)
+		len = GetTempPathA(MAX_PATH, buf);
+	if (!len || len >= MAX_PATH)
+		return {};
+
+	std::string dir(buf, len);
+	if (dir.back() != '\\' && dir.back() != '/')
+		dir += '\\';
+	dir += "flashgui";
+
+	if (!CreateDirectoryA(dir.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+		return {};
+
+	return dir + "\\pipeline_cache.bin";
+}
+
+bool c_pipeline_cache::make_header(file_header& out) const {
+	out = {};
+	out.magic = file_magic;
+	out.version = file_version;
+	out.shader_hash = m_shader_hash;
+
+	// hooked mode only has the device, find its adapter by LUID
+	ComPtr<IDXGIFactory4> factory;
+	if (FAILED(CreateDXGIFactory1(IID_PPV_ARGS(&factory))))
+		return false;
+
+	ComPtr<IDXGIAdapter1> adapter;
+	if (FAILED(factory->EnumAdapterByLuid(m_device->GetAdapterLuid(), IID_PPV_ARGS(&adapter))))
+		return false;
+
+	DXGI_ADAPTER_DESC1 desc{};
+	if (FAILED(adapter->GetDesc1(&desc)))
+		return false;
+
+	out.vendor_id = desc.VendorId;
+	out.device_id = desc.DeviceId;
+	out.subsys_id = desc.SubSysId;
+	out.revision = desc.Revision;
+
+	// the UMD version, bumps with every driver install
+	LARGE_INTEGER umd{};
+	if (SUCCEEDED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &umd)))
+		out.driver_version = static_cast<uint64_t>(umd.QuadPart);
+
+	return true;
+}
+
+void c_pipeline_cache::initialize(ComPtr<ID3D12Device> device, const std::string& path, uint64_t shader_hash) {
+	FGUI_TRACE_ZONE("pipeline_cache::initialize");
+
+	release();
+
+	m_device = device;
+	m_path = path;
+	m_shader_hash = shader_hash;
+
+	ComPtr<ID3D12Device1> device1;
+	if (m_path.empty() || !m_device || FAILED(m_device.As(&device1)))
+		return;
+
+	file_header expected{};
+	if (!make_header(expected)) {
+		m_stats.status = "adapter lookup failed";
+		return;
+	}
+
+	m_stats.status = "no cache file";
+
+	std::ifstream in(m_path, std::ios::binary);
+	if (in) {
+		file_header header{};
+		in.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		if (!in || header.magic != file_magic || header.version != file_version) {
+			m_stats.status = "unrecognized cache file";
+		}
+		else if (header.vendor_id != expected.vendor_id || header.device_id != expected.device_id ||
+			header.subsys_id != expected.subsys_id || header.revision != expected.revision) {
+			m_stats.status = "adapter changed";
+		}
+		else if (header.driver_version != expected.driver_version) {
+			m_stats.status = "driver changed";
+		}
+		else if (header.shader_hash != expected.shader_hash) {
+			m_stats.status = "shaders changed";
+		}
+		else {
+			m_blob.resize(static_cast<size_t>(header.blob_size));
+			in.read(reinterpret_cast<char*>(m_blob.data()), static_cast<std::streamsize>(m_blob.size()));
+
+			if (!in || m_blob.empty()) {
+				m_stats.status = "truncated cache file";
+				m_blob.clear();
+			}
+		}
+	}
+
+	if (!m_blob.empty()) {
+		// the runtime does its own driver/adapter check and rejects blobs we couldn't catch
+		const HRESULT hr = device1->CreatePipelineLibrary(m_blob.data(), m_blob.size(), IID_PPV_ARGS(&m_library));
+		if (SUCCEEDED(hr)) {
+			m_stats.loaded = true;
+			m_stats.status = "loaded";
+		}
+		else {
+			m_stats.status = hr == D3D12_ERROR_DRIVER_VERSION_MISMATCH ? "runtime: driver mismatch"
+				: hr == D3D12_ERROR_ADAPTER_NOT_FOUND ? "runtime: adapter not found"
+				: "runtime rejected cache file";
+			m_blob.clear();
+			m_library.Reset();
+		}
+	}
+
+	if (!m_library) {
+		const HRESULT hr = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_library));
+		if (FAILED(hr)) {
+			// some layers and older runtimes don't implement pipeline libraries, PSOs are just created directly
+			log_error("[flashgui] Pipeline libraries unsupported, HRESULT: " + std::to_string(hr) + "\n");
+			m_stats.status = "unsupported";
+			m_library.Reset();
+			return;
+		}
+		m_dirty = true; // even an empty library beats a stale file on the next launch
+	}
+
+	m_stats.enabled = true;
+}
+
+void c_pipeline_cache::release() {
+	m_library.Reset();
+	m_blob.clear();
+	m_device.Reset();
+	m_dirty = false;
+	m_stats = {};
+}
+
+uint64_t c_pipeline_cache::hash_desc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+	// the fixed function state field by field, the blend and depth stencil descs have padding a caller's
+	// desc doesn't have to zero. Then everything the pointers point at
+	const D3D12_BLEND_DESC& blend = desc.BlendState;
+	const UINT blend_fields[] = { UINT(blend.AlphaToCoverageEnable), UINT(blend.IndependentBlendEnable) };
+	uint64_t h = fnv1a_64(blend_fields, sizeof(blend_fields));
+
+	for (const D3D12_RENDER_TARGET_BLEND_DESC& rt : blend.RenderTarget) {
+		const UINT fields[] = { UINT(rt.BlendEnable), UINT(rt.LogicOpEnable), UINT(rt.SrcBlend), UINT(rt.DestBlend), UINT(rt.BlendOp),
+			UINT(rt.SrcBlendAlpha), UINT(rt.DestBlendAlpha), UINT(rt.BlendOpAlpha), UINT(rt.LogicOp), UINT(rt.RenderTargetWriteMask) };
+		h = fnv1a_64(fields, sizeof(fields), h);
+	}
+
+	// only 4 byte members, no padding to skip
+	static_assert(sizeof(D3D12_RASTERIZER_DESC) == 11 * 4, "D3D12_RASTERIZER_DESC layout changed");
+	h = fnv1a_64(&desc.RasterizerState, sizeof(desc.RasterizerState), h);
+
+	const D3D12_DEPTH_STENCIL_DESC& ds = desc.DepthStencilState;
+	const UINT ds_fields[] = { UINT(ds.DepthEnable), UINT(ds.DepthWriteMask), UINT(ds.DepthFunc), UINT(ds.StencilEnable),
+		UINT(ds.StencilReadMask), UINT(ds.StencilWriteMask),
+		UINT(ds.FrontFace.StencilFailOp), UINT(ds.FrontFace.StencilDepthFailOp), UINT(ds.FrontFace.StencilPassOp), UINT(ds.FrontFace.StencilFunc),
+		UINT(ds.BackFace.StencilFailOp), UINT(ds.BackFace.StencilDepthFailOp), UINT(ds.BackFace.StencilPassOp), UINT(ds.BackFace.StencilFunc) };
+	h = fnv1a_64(ds_fields, sizeof(ds_fields), h);
+
+	const UINT fields[] = { desc.SampleMask, UINT(desc.IBStripCutValue), UINT(desc.PrimitiveTopologyType), desc.NumRenderTargets,
+		UINT(desc.RTVFormats[0]), UINT(desc.RTVFormats[1]), UINT(desc.RTVFormats[2]), UINT(desc.RTVFormats[3]),
+		UINT(desc.RTVFormats[4]), UINT(desc.RTVFormats[5]), UINT(desc.RTVFormats[6]), UINT(desc.RTVFormats[7]),
+		UINT(desc.DSVFormat), desc.SampleDesc.Count, desc.SampleDesc.Quality, desc.NodeMask, UINT(desc.Flags), desc.InputLayout.NumElements };
+	h = fnv1a_64(fields, sizeof(fields), h);
+
+	h = fnv1a_64(desc.VS.pShaderBytecode, desc.VS.BytecodeLength, h);
+	h = fnv1a_64(desc.PS.pShaderBytecode, desc.PS.BytecodeLength, h);
+
+	for (UINT i = 0; i < desc.InputLayout.NumElements; ++i) {
+		const D3D12_INPUT_ELEMENT_DESC& e = desc.InputLayout.pInputElementDescs[i];
+		if (e.SemanticName)
+			h = fnv1a_64(e.SemanticName, std::strlen(e.SemanticName), h);
+
+		const UINT element[] = { e.SemanticIndex, UINT(e.Format), e.InputSlot, e.AlignedByteOffset, UINT(e.InputSlotClass), e.InstanceDataStepRate };
+		h = fnv1a_64(element, sizeof(element), h);
+	}
+
+	return h;
+}
+
+uint64_t c_pipeline_cache::hash_desc(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc) {
+	const UINT fields[] = { desc.NodeMask, UINT(desc.Flags) };
+	const uint64_t h = fnv1a_64(fields, sizeof(fields));
+	return fnv1a_64(desc.CS.pShaderBytecode, desc.CS.BytecodeLength, h);
+}
+
+std::wstring c_pipeline_cache::make_key(const wchar_t* name, uint64_t desc_hash) {
+	wchar_t suffix[24];
+	swprintf(suffix, 24, L"_%016llx", static_cast<unsigned long long>(desc_hash));
+	return std::wstring(name) + suffix;
+}
+
+ComPtr<ID3D12PipelineState> c_pipeline_cache::get_or_create(const wchar_t* name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+	ComPtr<ID3D12PipelineState> pso;
+
+	if (!m_library) {
+		if (FAILED(m_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pso))))
+			return nullptr;
+		++m_stats.misses;
+		return pso;
+	}
+
+	const std::wstring key = make_key(name, hash_desc(desc));
+
+	if (SUCCEEDED(m_library->LoadGraphicsPipeline(key.c_str(), &desc, IID_PPV_ARGS(&pso)))) {
+		++m_stats.hits;
+		return pso;
+	}
+
+	HRESULT hr = m_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pso));
+	if (FAILED(hr)) {
+		log_error("[flashgui] CreateGraphicsPipelineState failed, HRESULT: " + std::to_string(hr) + "\n");
+		return nullptr;
+	}
+	++m_stats.misses;
+
+	store(key, pso.Get());
+	return pso;
+}
+
+ComPtr<ID3D12PipelineState> c_pipeline_cache::get_or_create(const wchar_t* name, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc) {
+	ComPtr<ID3D12PipelineState> pso;
+
+	if (!m_library) {
+		if (FAILED(m_device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&pso))))
+			return nullptr;
+		++m_stats.misses;
+		return pso;
+	}
+
+	const std::wstring key = make_key(name, hash_desc(desc));
+
+	if (SUCCEEDED(m_library->LoadComputePipeline(key.c_str(), &desc, IID_PPV_ARGS(&pso)))) {
+		++m_stats.hits;
+		return pso;
+	}
+
+	HRESULT hr = m_device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&pso));
+	if (FAILED(hr)) {
+		log_error("[flashgui] CreateComputePipelineState failed, HRESULT: " + std::to_string(hr) + "\n");
+		return nullptr;
+	}
+	++m_stats.misses;
+
+	store(key, pso.Get());
+	return pso;
+}
+
+void c_pipeline_cache::store(const std::wstring& key, ID3D12PipelineState* pso) {
+	HRESULT hr = m_library->StorePipeline(key.c_str(), pso);
+	if (hr == E_INVALIDARG) {
+		// the name is taken by a desc our hash didn't tell apart (root signature changed), start over
+		ComPtr<ID3D12Device1> device1;
+		if (SUCCEEDED(m_device.As(&device1))) {
+			ComPtr<ID3D12PipelineLibrary> fresh;
+			if (SUCCEEDED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&fresh)))) {
+				m_library = fresh;
+				m_stats.loaded = false;
+				m_stats.status = "stale entry, rebuilt";
+				hr = m_library->StorePipeline(key.c_str(), pso);
+			}
+		}
+	}
+
+	if (SUCCEEDED(hr))
+		m_dirty = true;
+	else
+		log_error("[flashgui] StorePipeline failed, HRESULT: " + std::to_string(hr) + "\n");
+}
+
+void c_pipeline_cache::save() {
+	if (!m_library || !m_dirty || m_path.empty())
+		return;
+
+	FGUI_TRACE_ZONE("pipeline_cache::save");
+
+	file_header header{};
+	if (!make_header(header))
+		return;
+
+	std::vector<uint8_t> blob(m_library->GetSerializedSize());
+	if (blob.empty() || FAILED(m_library->Serialize(blob.data(), blob.size()))) {
+		log_error("[flashgui] Failed to serialize pipeline library\n");
+		return;
+	}
+	header.blob_size = blob.size();
+
+	// processes (or renderers) sharing a cache path each write their own temporary, the last rename wins
+	static std::atomic<uint32_t> save_counter{ 0 };
+	const std::string tmp = m_path + "." + std::to_string(GetCurrentProcessId()) + "." + std::to_string(save_counter++) + ".tmp";
+	{
+		std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+		if (!out) {
+			log_error("[flashgui] Failed to write pipeline cache: " + tmp + "\n");
+			return;
+		}
+	}
+
+	if (!MoveFileExA(tmp.c_str(), m_path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+		log_error("[flashgui] Failed to replace pipeline cache: " + m_path + "\n");
+		DeleteFileA(tmp.c_str());
+		return;
+	}
+
+	m_dirty = false;
+}
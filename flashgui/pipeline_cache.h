@@ -0,0 +1,74 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	struct pipeline_cache_stats {
+		bool enabled = false;   // device supports pipeline libraries and a path is set
+		bool loaded = false;    // a matching cache file was found and accepted
+		const char* status = "disabled"; // why the file was or wasn't used
+		uint32_t hits = 0;      // PSOs loaded from the library
+		uint32_t misses = 0;    // PSOs compiled and stored
+		double pipeline_ms = 0.0; // all of create_pipeline, graphics and compute PSOs, compare a cold and a warm start
+	};
+
+	// ID3D12PipelineLibrary persisted to disk. The file header carries the adapter, the UMD driver version
+	// and a hash of our shader bytecode, any mismatch (or the runtime rejecting the blob) starts an empty
+	// library that replaces the file on save. PSO names include a hash of their desc, so a different
+	// backbuffer format in another host gets its own entry instead of failing the load.
+	class c_pipeline_cache {
+	public:
+		// empty path disables the cache, PSOs are then created directly
+		void initialize(ComPtr<ID3D12Device> device, const std::string& path, uint64_t shader_hash);
+		void release();
+
+		ComPtr<ID3D12PipelineState> get_or_create(const wchar_t* name, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+		ComPtr<ID3D12PipelineState> get_or_create(const wchar_t* name, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc);
+
+		// writes the library back if anything was added, through a temp file so a crash never leaves half a cache
+		void save();
+
+		pipeline_cache_stats& stats() { return m_stats; }
+		const pipeline_cache_stats& stats() const { return m_stats; }
+
+		// %LOCALAPPDATA%\flashgui\pipeline_cache.bin
+		static std::string default_path();
+
+	private:
+		struct file_header {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t vendor_id;
+			uint32_t device_id;
+			uint32_t subsys_id;
+			uint32_t revision;
+			uint64_t driver_version;
+			uint64_t shader_hash;
+			uint64_t blob_size;
+		};
+
+		static constexpr uint32_t file_magic = 0x43505746; // "FWPC"
+		static constexpr uint32_t file_version = 2; // 2: PSO names hash the desc field by field
+
+		bool make_header(file_header& out) const;
+		static uint64_t hash_desc(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+		static uint64_t hash_desc(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc);
+		static std::wstring make_key(const wchar_t* name, uint64_t desc_hash); // name + the desc hash
+		void store(const std::wstring& key, ID3D12PipelineState* pso);
+
+		ComPtr<ID3D12Device> m_device;
+		ComPtr<ID3D12PipelineLibrary> m_library;
+		std::vector<uint8_t> m_blob; // the library reads from this memory for as long as it lives
+
+		std::string m_path;
+		uint64_t m_shader_hash = 0;
+		bool m_dirty = false;
+
+		pipeline_cache_stats m_stats{};
+	};
+}
@@ -0,0 +1,495 @@
+#include "pch.h"
+#include "pixel_convert.h"
+
+#include <atomic>
+#include <cfloat>
+#include <cstring>
+#include <random>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define FGUI_PX_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC emits AVX2 intrinsics without /arch:AVX2, gcc/clang need the function to opt in
+#if defined(__GNUC__) || defined(__clang__)
+#define FGUI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FGUI_TARGET_AVX2
+#endif
+
+using namespace fgui;
+
+static std::atomic<int> g_simd_level{ -1 };
+
+// exact round(c * a / 255) without a divide, shared by every path so results match bit for bit
+static inline uint8_t mul_div255(uint32_t c, uint32_t a) {
+	const uint32_t t = c * a + 128;
+	return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+}
+
+static void gray_to_rgba_scalar(const uint8_t* src, uint8_t* dst, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		dst[i * 4 + 0] = src[i];
+		dst[i * 4 + 1] = src[i];
+		dst[i * 4 + 2] = src[i];
+		dst[i * 4 + 3] = 255;
+	}
+}
+
+static void gray_alpha_to_rgba_scalar(const uint8_t* src, uint8_t* dst, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		dst[i * 4 + 0] = src[i * 2];
+		dst[i * 4 + 1] = src[i * 2];
+		dst[i * 4 + 2] = src[i * 2];
+		dst[i * 4 + 3] = src[i * 2 + 1];
+	}
+}
+
+static void rgb_to_rgba_scalar(const uint8_t* src, uint8_t* dst, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		dst[i * 4 + 0] = src[i * 3 + 0];
+		dst[i * 4 + 1] = src[i * 3 + 1];
+		dst[i * 4 + 2] = src[i * 3 + 2];
+		dst[i * 4 + 3] = 255;
+	}
+}
+
+static void bgra_to_rgba_scalar(const uint8_t* src, uint8_t* dst, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		dst[i * 4 + 0] = src[i * 4 + 2];
+		dst[i * 4 + 1] = src[i * 4 + 1];
+		dst[i * 4 + 2] = src[i * 4 + 0];
+		dst[i * 4 + 3] = src[i * 4 + 3];
+	}
+}
+
+static void premultiply_scalar(uint8_t* rgba, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		uint8_t* p = rgba + i * 4;
+		const uint32_t a = p[3];
+		p[0] = mul_div255(p[0], a);
+		p[1] = mul_div255(p[1], a);
+		p[2] = mul_div255(p[2], a);
+	}
+}
+
+#ifdef FGUI_PX_X86
+
+// SSE2
+
+static void gray_to_rgba_sse2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m128i ff = _mm_set1_epi8(-1);
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+		// (g,g) and (g,255) byte pairs, interleaved as 16 bit words give g,g,g,255
+		const __m128i gg_lo = _mm_unpacklo_epi8(g, g);
+		const __m128i gg_hi = _mm_unpackhi_epi8(g, g);
+		const __m128i ga_lo = _mm_unpacklo_epi8(g, ff);
+		const __m128i ga_hi = _mm_unpackhi_epi8(g, ff);
+
+		__m128i* out = reinterpret_cast<__m128i*>(dst + i * 4);
+		_mm_storeu_si128(out + 0, _mm_unpacklo_epi16(gg_lo, ga_lo));
+		_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(gg_lo, ga_lo));
+		_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(gg_hi, ga_hi));
+		_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(gg_hi, ga_hi));
+	}
+
+	gray_to_rgba_scalar(src + i, dst + i * 4, count - i);
+}
+
+static void gray_alpha_to_rgba_sse2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m128i lo_byte = _mm_set1_epi16(0x00FF);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		// each 16 bit word is already (g,a), build (g,g) next to it
+		const __m128i ga = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+		const __m128i g = _mm_and_si128(ga, lo_byte);
+		const __m128i gg = _mm_or_si128(g, _mm_slli_epi16(g, 8));
+
+		__m128i* out = reinterpret_cast<__m128i*>(dst + i * 4);
+		_mm_storeu_si128(out + 0, _mm_unpacklo_epi16(gg, ga));
+		_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(gg, ga));
+	}
+
+	gray_alpha_to_rgba_scalar(src + i * 2, dst + i * 4, count - i);
+}
+
+static void rgb_to_rgba_sse2(const uint8_t* src, uint8_t* dst, size_t count) {
+	// no byte shuffle in SSE2: shift the whole register left by 0..3 bytes and mask one pixel out of each
+	const __m128i m0 = _mm_set_epi32(0, 0, 0, 0x00FFFFFF);
+	const __m128i m1 = _mm_set_epi32(0, 0, 0x00FFFFFF, 0);
+	const __m128i m2 = _mm_set_epi32(0, 0x00FFFFFF, 0, 0);
+	const __m128i m3 = _mm_set_epi32(0x00FFFFFF, 0, 0, 0);
+	const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+	// 4 pixels use 12 bytes but the load reads 16, stop while the read still stays inside src
+	size_t i = 0;
+	for (; i + 6 <= count; i += 4) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+
+		__m128i out = _mm_or_si128(_mm_and_si128(v, m0), alpha);
+		out = _mm_or_si128(out, _mm_and_si128(_mm_slli_si128(v, 1), m1));
+		out = _mm_or_si128(out, _mm_and_si128(_mm_slli_si128(v, 2), m2));
+		out = _mm_or_si128(out, _mm_and_si128(_mm_slli_si128(v, 3), m3));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), out);
+	}
+
+	rgb_to_rgba_scalar(src + i * 3, dst + i * 4, count - i);
+}
+
+static void bgra_to_rgba_sse2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m128i ga_mask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+	const __m128i rb_mask = _mm_set1_epi32(0x00FF00FF);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+
+		// swap bytes 0 and 2 of every pixel by rotating the r/b pair 16 bits
+		const __m128i rb = _mm_and_si128(v, rb_mask);
+		const __m128i swapped = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(_mm_and_si128(v, ga_mask), swapped));
+	}
+
+	bgra_to_rgba_scalar(src + i * 4, dst + i * 4, count - i);
+}
+
+static inline __m128i premultiply_2px_sse2(__m128i px16, __m128i bias) {
+	// broadcast each pixel's alpha word over its 4 channels
+	const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	__m128i t = _mm_add_epi16(_mm_mullo_epi16(px16, a), bias);
+	t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+	return t;
+}
+
+static void premultiply_sse2(uint8_t* rgba, size_t count) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i bias = _mm_set1_epi16(128);
+	const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i* p = reinterpret_cast<__m128i*>(rgba + i * 4);
+		const __m128i v = _mm_loadu_si128(p);
+
+		const __m128i lo = premultiply_2px_sse2(_mm_unpacklo_epi8(v, zero), bias);
+		const __m128i hi = premultiply_2px_sse2(_mm_unpackhi_epi8(v, zero), bias);
+		const __m128i rgb = _mm_packus_epi16(lo, hi);
+
+		// alpha went through the multiply too, put the original back
+		_mm_storeu_si128(p, _mm_or_si128(_mm_andnot_si128(alpha_mask, rgb), _mm_and_si128(v, alpha_mask)));
+	}
+
+	premultiply_scalar(rgba + i * 4, count - i);
+}
+
+// AVX2
+
+FGUI_TARGET_AVX2
+static void gray_to_rgba_avx2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		for (size_t half = 0; half < 16; half += 8) {
+			// zero extend 8 grays to dwords, then replicate into bytes 1 and 2
+			const __m256i g = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + half)));
+			__m256i out = _mm256_or_si256(g, _mm256_slli_epi32(g, 8));
+			out = _mm256_or_si256(out, _mm256_slli_epi32(g, 16));
+			out = _mm256_or_si256(out, alpha);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (i + half) * 4), out);
+		}
+	}
+
+	gray_to_rgba_scalar(src + i, dst + i * 4, count - i);
+}
+
+FGUI_TARGET_AVX2
+static void gray_alpha_to_rgba_avx2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m256i lo_byte = _mm256_set1_epi16(0x00FF);
+
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m256i ga = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 2));
+		const __m256i g = _mm256_and_si256(ga, lo_byte);
+		const __m256i gg = _mm256_or_si256(g, _mm256_slli_epi16(g, 8));
+
+		// unpack works per 128 bit lane: lo = px 0-3 | 8-11, hi = px 4-7 | 12-15
+		const __m256i lo = _mm256_unpacklo_epi16(gg, ga);
+		const __m256i hi = _mm256_unpackhi_epi16(gg, ga);
+
+		__m256i* out = reinterpret_cast<__m256i*>(dst + i * 4);
+		_mm256_storeu_si256(out + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+		_mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+	}
+
+	gray_alpha_to_rgba_scalar(src + i * 2, dst + i * 4, count - i);
+}
+
+FGUI_TARGET_AVX2
+static void rgb_to_rgba_avx2(const uint8_t* src, uint8_t* dst, size_t count) {
+	// move source bytes 12..27 into the upper lane so each lane holds 4 whole pixels at its start
+	const __m256i lane_split = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+	const __m256i shuffle = _mm256_setr_epi8(
+		0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+		0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+	// 8 pixels use 24 bytes but the load reads 32
+	size_t i = 0;
+	for (; i + 11 <= count; i += 8) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 3));
+		v = _mm256_permutevar8x32_epi32(v, lane_split);
+		v = _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alpha);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), v);
+	}
+
+	rgb_to_rgba_sse2(src + i * 3, dst + i * 4, count - i);
+}
+
+FGUI_TARGET_AVX2
+static void bgra_to_rgba_avx2(const uint8_t* src, uint8_t* dst, size_t count) {
+	const __m256i shuffle = _mm256_setr_epi8(
+		2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+		2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_shuffle_epi8(v, shuffle));
+	}
+
+	bgra_to_rgba_scalar(src + i * 4, dst + i * 4, count - i);
+}
+
+FGUI_TARGET_AVX2
+static inline __m256i premultiply_2px_avx2(__m256i px16, __m256i bias) {
+	const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	__m256i t = _mm256_add_epi16(_mm256_mullo_epi16(px16, a), bias);
+	t = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+	return t;
+}
+
+FGUI_TARGET_AVX2
+static void premultiply_avx2(uint8_t* rgba, size_t count) {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i bias = _mm256_set1_epi16(128);
+	const __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i* p = reinterpret_cast<__m256i*>(rgba + i * 4);
+		const __m256i v = _mm256_loadu_si256(p);
+
+		// unpack and pack are both per lane, so the pixel order comes back unchanged
+		const __m256i lo = premultiply_2px_avx2(_mm256_unpacklo_epi8(v, zero), bias);
+		const __m256i hi = premultiply_2px_avx2(_mm256_unpackhi_epi8(v, zero), bias);
+		const __m256i rgb = _mm256_packus_epi16(lo, hi);
+
+		_mm256_storeu_si256(p, _mm256_or_si256(_mm256_andnot_si256(alpha_mask, rgb), _mm256_and_si256(v, alpha_mask)));
+	}
+
+	premultiply_sse2(rgba + i * 4, count - i);
+}
+
+static bool cpu_has_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+	int regs[4] = {};
+	__cpuid(regs, 0);
+	if (regs[0] < 7)
+		return false;
+
+	// the OS has to save the ymm registers too (OSXSAVE + XCR0 bits 1 and 2)
+	__cpuid(regs, 1);
+	const bool osxsave = (regs[2] & (1 << 27)) != 0;
+	const bool avx = (regs[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+
+	__cpuidex(regs, 7, 0);
+	return (regs[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // FGUI_PX_X86
+
+px::simd_level px::detected_simd_level() {
+#ifdef FGUI_PX_X86
+	static const simd_level level = cpu_has_avx2() ? simd_level::avx2 : simd_level::sse2;
+	return level;
+#else
+	return simd_level::scalar;
+#endif
+}
+
+px::simd_level px::active_simd_level() {
+	int level = g_simd_level.load(std::memory_order_relaxed);
+	if (level < 0) {
+		level = static_cast<int>(detected_simd_level());
+		g_simd_level.store(level, std::memory_order_relaxed);
+	}
+	return static_cast<simd_level>(level);
+}
+
+void px::set_simd_level(simd_level level) {
+	const int clamped = std::min(static_cast<int>(level), static_cast<int>(detected_simd_level()));
+	g_simd_level.store(clamped, std::memory_order_relaxed);
+}
+
+const char* px::simd_level_name(simd_level level) {
+	switch (level) {
+	case simd_level::avx2: return "avx2";
+	case simd_level::sse2: return "sse2";
+	default: return "scalar";
+	}
+}
+
+uint32_t px::bytes_per_pixel(pixel_layout layout) {
+	switch (layout) {
+	case pixel_layout::gray: return 1;
+	case pixel_layout::gray_alpha: return 2;
+	case pixel_layout::rgb: return 3;
+	default: return 4;
+	}
+}
+
+void px::gray_to_rgba(const uint8_t* src, uint8_t* dst, size_t count) {
+	switch (active_simd_level()) {
+#ifdef FGUI_PX_X86
+	case simd_level::avx2: gray_to_rgba_avx2(src, dst, count); break;
+	case simd_level::sse2: gray_to_rgba_sse2(src, dst, count); break;
+#endif
+	default: gray_to_rgba_scalar(src, dst, count); break;
+	}
+}
+
+void px::gray_alpha_to_rgba(const uint8_t* src, uint8_t* dst, size_t count) {
+	switch (active_simd_level()) {
+#ifdef FGUI_PX_X86
+	case simd_level::avx2: gray_alpha_to_rgba_avx2(src, dst, count); break;
+	case simd_level::sse2: gray_alpha_to_rgba_sse2(src, dst, count); break;
+#endif
+	default: gray_alpha_to_rgba_scalar(src, dst, count); break;
+	}
+}
+
+void px::rgb_to_rgba(const uint8_t* src, uint8_t* dst, size_t count) {
+	switch (active_simd_level()) {
+#ifdef FGUI_PX_X86
+	case simd_level::avx2: rgb_to_rgba_avx2(src, dst, count); break;
+	case simd_level::sse2: rgb_to_rgba_sse2(src, dst, count); break;
+#endif
+	default: rgb_to_rgba_scalar(src, dst, count); break;
+	}
+}
+
+void px::bgra_to_rgba(const uint8_t* src, uint8_t* dst, size_t count) {
+	switch (active_simd_level()) {
+#ifdef FGUI_PX_X86
+	case simd_level::avx2: bgra_to_rgba_avx2(src, dst, count); break;
+	case simd_level::sse2: bgra_to_rgba_sse2(src, dst, count); break;
+#endif
+	default: bgra_to_rgba_scalar(src, dst, count); break;
+	}
+}
+
+void px::premultiply_rgba(uint8_t* rgba, size_t count) {
+	switch (active_simd_level()) {
+#ifdef FGUI_PX_X86
+	case simd_level::avx2: premultiply_avx2(rgba, count); break;
+	case simd_level::sse2: premultiply_sse2(rgba, count); break;
+#endif
+	default: premultiply_scalar(rgba, count); break;
+	}
+}
+
+void px::convert_to_premultiplied_rgba(const uint8_t* src, pixel_layout layout, uint8_t* dst, size_t count) {
+	switch (layout) {
+	case pixel_layout::gray:
+		gray_to_rgba(src, dst, count);
+		return; // opaque, nothing to premultiply
+	case pixel_layout::rgb:
+		rgb_to_rgba(src, dst, count);
+		return;
+	case pixel_layout::gray_alpha:
+		gray_alpha_to_rgba(src, dst, count);
+		break;
+	case pixel_layout::bgra:
+		bgra_to_rgba(src, dst, count);
+		break;
+	case pixel_layout::rgba:
+		memcpy(dst, src, count * 4);
+		break;
+	}
+
+	premultiply_rgba(dst, count);
+}
+
+std::vector<uint8_t> px::to_premultiplied_rgba(const uint8_t* src, pixel_layout layout, uint32_t width, uint32_t height) {
+	const size_t count = size_t(width) * height;
+	std::vector<uint8_t> out(count * 4);
+	convert_to_premultiplied_rgba(src, layout, out.data(), count);
+	return out;
+}
+
+std::vector<px::bench_result> px::run_benchmark(size_t pixel_count, int iterations) {
+	using clock = std::chrono::steady_clock;
+
+	std::vector<uint8_t> src(pixel_count * 4);
+	std::vector<uint8_t> dst(pixel_count * 4);
+
+	std::mt19937 rng(1234);
+	for (auto& b : src)
+		b = static_cast<uint8_t>(rng());
+
+	struct kernel {
+		const char* name;
+		size_t src_bpp;
+		void (*run)(const uint8_t*, uint8_t*, size_t);
+	};
+
+	const kernel kernels[] = {
+		{ "gray -> rgba", 1, [](const uint8_t* s, uint8_t* d, size_t n) { gray_to_rgba(s, d, n); } },
+		{ "gray+alpha -> rgba", 2, [](const uint8_t* s, uint8_t* d, size_t n) { gray_alpha_to_rgba(s, d, n); } },
+		{ "rgb -> rgba", 3, [](const uint8_t* s, uint8_t* d, size_t n) { rgb_to_rgba(s, d, n); } },
+		{ "bgra -> rgba", 4, [](const uint8_t* s, uint8_t* d, size_t n) { bgra_to_rgba(s, d, n); } },
+		{ "premultiply", 4, [](const uint8_t*, uint8_t* d, size_t n) { premultiply_rgba(d, n); } },
+	};
+
+	const simd_level previous = active_simd_level();
+	std::vector<bench_result> results;
+
+	for (int level = 0; level <= static_cast<int>(detected_simd_level()); ++level) {
+		set_simd_level(static_cast<simd_level>(level));
+
+		for (const kernel& k : kernels) {
+			double best = DBL_MAX;
+			for (int it = 0; it < iterations; ++it) {
+				const auto start = clock::now();
+				k.run(src.data(), dst.data(), pixel_count);
+				best = std::min(best, std::chrono::duration<double>(clock::now() - start).count());
+			}
+
+			const double bytes = double(pixel_count) * double(k.src_bpp);
+			results.push_back({ k.name, static_cast<simd_level>(level), best > 0.0 ? bytes / best / 1e6 : 0.0 });
+		}
+	}
+
+	set_simd_level(previous);
+	return results;
+}
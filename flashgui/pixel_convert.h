@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fgui {
+	// Source pixel layouts accepted by the image loader, 8 bits per channel
+	enum class pixel_layout {
+		gray,       // 1 byte, expands to g,g,g,255
+		gray_alpha, // 2 bytes, expands to g,g,g,a
+		rgb,        // 3 bytes, alpha becomes 255
+		rgba,       // 4 bytes
+		bgra,       // 4 bytes, red/blue swapped (GDI/WIC/DXGI backbuffer order)
+	};
+
+	// Load-time pixel conversion into premultiplied RGBA8, the only format images are stored in on the GPU.
+	// Every kernel has an AVX2 and SSE2 path picked once at startup from cpuid, plus a scalar fallback
+	// that all the vector paths match bit for bit.
+	namespace px {
+		enum class simd_level { scalar, sse2, avx2 };
+
+		// best level supported by this cpu
+		simd_level detected_simd_level();
+
+		// level used by the kernels, defaults to detected_simd_level()
+		simd_level active_simd_level();
+
+		// force a lower level (clamped to what the cpu supports), used by the benchmark
+		void set_simd_level(simd_level level);
+
+		const char* simd_level_name(simd_level level);
+
+		uint32_t bytes_per_pixel(pixel_layout layout);
+
+		// dst always receives count * 4 bytes, src and dst must not overlap
+		void gray_to_rgba(const uint8_t* src, uint8_t* dst, size_t count);
+		void gray_alpha_to_rgba(const uint8_t* src, uint8_t* dst, size_t count);
+		void rgb_to_rgba(const uint8_t* src, uint8_t* dst, size_t count);
+		void bgra_to_rgba(const uint8_t* src, uint8_t* dst, size_t count);
+
+		// in place, rgb = rgb * a / 255 rounded to nearest
+		void premultiply_rgba(uint8_t* rgba, size_t count);
+
+		// any layout -> premultiplied RGBA8, premultiply is skipped for layouts without alpha
+		void convert_to_premultiplied_rgba(const uint8_t* src, pixel_layout layout, uint8_t* dst, size_t count);
+		std::vector<uint8_t> to_premultiplied_rgba(const uint8_t* src, pixel_layout layout, uint32_t width, uint32_t height);
+
+		struct bench_result {
+			const char* kernel;
+			simd_level level;
+			double mb_per_sec; // measured on source bytes
+		};
+
+		// times every kernel at every supported level over pixel_count pixels, best of iterations
+		std::vector<bench_result> run_benchmark(size_t pixel_count = 4096 * 4096, int iterations = 10);
+	}
+}
@@ -48,7 +48,7 @@ static HWND find_process_window(DWORD pid, const char* class_name = nullptr) {
 	return params.found_hwnd;
 }
 
-c_process::c_process(bool create_window, DWORD pid, HINSTANCE module_handle, HWND in_hwnd) {
+c_process::c_process(bool create_window, DWORD pid, HINSTANCE module_handle, HWND in_hwnd) : m_pid(pid), m_hinstance(module_handle) {
 	if (create_window) {
 		WNDCLASSEXA wc = {};
 		wc.cbSize = sizeof(WNDCLASSEXA);
@@ -60,7 +60,8 @@ c_process::c_process(bool create_window, DWORD pid, HINSTANCE module_handle, HWN
 		wc.hIcon = LoadIcon(nullptr, IDI_APPLICATION); // Set a default icon
 		wc.hIconSm = LoadIcon(nullptr, IDI_APPLICATION); // Set a small icon
 
-		if (!RegisterClassExA(&wc)) {
+		// every instance's window shares the class, only the first one registers it
+		if (!RegisterClassExA(&wc) && GetLastError() != ERROR_CLASS_ALREADY_EXISTS) {
 			throw std::runtime_error("Failed to register window class");
 		}
 
@@ -78,12 +79,13 @@ c_process::c_process(bool create_window, DWORD pid, HINSTANCE module_handle, HWN
 			nullptr, // No parent window
 			nullptr, // No menu
 			wc.hInstance, // Use provided instance handle or current module handle
-			this // Pass this instance as user data
+			this // Pass this instance as user data, stored on WM_NCCREATE
 		);
 			
 		if (!window.handle) {
 			throw std::runtime_error("Failed to create window");
 		}
+		m_owns_window = true;
 
 		ShowWindow(window.handle, SW_SHOW); // show the window
 		UpdateWindow(window.handle); // update the window to ensure it is drawn
@@ -102,6 +104,30 @@ c_process::c_process(bool create_window, DWORD pid, HINSTANCE module_handle, HWN
 	}
 }
 
+c_process::c_process(vec2i size) : m_pid(GetCurrentProcessId()), m_hinstance(GetModuleHandleA(nullptr)), m_headless(true) {
+	window.set_size(static_cast<UINT>(std::max(size.x, 1)), static_cast<UINT>(std::max(size.y, 1)));
+}
+
+c_process::~c_process() {
+	if (!window.handle || !IsWindow(window.handle))
+		return;
+
+	// messages still arriving go straight to DefWindowProc instead of a destroyed c_process
+	if (GetWindowLongPtrA(window.handle, GWLP_USERDATA) == reinterpret_cast<LONG_PTR>(this))
+		SetWindowLongPtrA(window.handle, GWLP_USERDATA, 0);
+
+	if (m_owns_window)
+		DestroyWindow(window.handle);
+}
+
+void c_process::resize(UINT width, UINT height) {
+	if (width == 0 || height == 0 || (width == window.width && height == window.height))
+		return;
+
+	window.set_size(width, height);
+	m_needs_resize = true;
+}
+
 void c_process::end_input_frame() {
 	for (int i = 0; i < 5; i++) {
 		input.mouse_clicked[i] = false;
@@ -6,9 +6,12 @@
 #include <wrl.h>
 #include <wrl/client.h>
 #include <chrono>
+#include <atomic>
 #include "vec2.h"
 
 namespace fgui {
+	// A window and its input, owned by whoever created the renderer that draws for it. Windows created here carry
+	// their c_process in GWLP_USERDATA, hk::window_procedure forwards their messages to it
 	class c_process {
 	public:
 		c_process(bool create_window = true,
@@ -16,10 +19,22 @@ namespace fgui {
 			HINSTANCE module_handle = GetModuleHandleA(nullptr),
 			HWND in_hwnd = nullptr);
 
+		// headless: no window, size is what the renderer's offscreen targets are created at
+		explicit c_process(vec2i size);
+
+		~c_process();
+
+		c_process(const c_process&) = delete;
+		c_process& operator=(const c_process&) = delete;
+
 		bool needs_resize() const { return m_needs_resize; }
 		void resize_complete() { m_needs_resize = false; }
 		HINSTANCE get_instance() const { return m_hinstance; }
 		DWORD get_pid() const { return m_pid; }
+		bool headless() const { return m_headless; }
+
+		// what WM_SIZE does for a window, headless targets are recreated at the next begin_frame
+		void resize(UINT width, UINT height);
 
 		struct window_info {
 			HWND handle = nullptr;
@@ -67,9 +82,11 @@ namespace fgui {
 
 		DWORD m_pid = 0;
 		HINSTANCE m_hinstance = nullptr;
-		bool m_needs_resize = false;
+		std::atomic<bool> m_needs_resize = false; // set by the window thread, read by the render (and UI) thread
 
 		bool m_minimized = false;
+		bool m_headless = false;
+		bool m_owns_window = false; // created by the constructor, destroyed with it
 	};
 
 	struct hook_data {
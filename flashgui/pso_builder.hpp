@@ -8,6 +8,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <directx/d3dx12.h>
+#include "pipeline_cache.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -171,7 +172,8 @@ namespace fgui {
 			return *this;
 		}
 
-		ComPtr<ID3D12PipelineState> build() {
+		// validated desc, points into this builder so it must outlive any use of the desc
+		D3D12_GRAPHICS_PIPELINE_STATE_DESC describe() {
 			if (!m_device) {
 				throw std::runtime_error("Invalid D3D12 device");
 			}
@@ -246,6 +248,12 @@ namespace fgui {
 			pso_desc.NodeMask = m_node_mask;
 			pso_desc.Flags = m_flags;
 
+			return pso_desc;
+		}
+
+		ComPtr<ID3D12PipelineState> build() {
+			const D3D12_GRAPHICS_PIPELINE_STATE_DESC pso_desc = describe();
+
 			ComPtr<ID3D12PipelineState> pipeline_state;
 			HRESULT hr = m_device->CreateGraphicsPipelineState(&pso_desc, IID_PPV_ARGS(&pipeline_state));
 			if (FAILED(hr)) {
@@ -262,6 +270,23 @@ namespace fgui {
 			return pipeline_state;
 		}
 
+		// loads the PSO from the pipeline library, compiling and storing it on a miss. the debug name is the library key
+		ComPtr<ID3D12PipelineState> build(c_pipeline_cache& cache) {
+			if (m_debug_name.empty()) {
+				throw std::runtime_error("Cached PSOs need a debug name");
+			}
+
+			const D3D12_GRAPHICS_PIPELINE_STATE_DESC pso_desc = describe();
+
+			ComPtr<ID3D12PipelineState> pipeline_state = cache.get_or_create(std::wstring(m_debug_name.begin(), m_debug_name.end()).c_str(), pso_desc);
+			if (!pipeline_state) {
+				throw std::runtime_error("Failed to create graphics pipeline state");
+			}
+
+			pipeline_state->SetName(std::wstring(m_debug_name.begin(), m_debug_name.end()).c_str());
+			return pipeline_state;
+		}
+
 	private:
 		ComPtr<ID3D12Device> m_device = nullptr;
 		ComPtr<ID3DBlob> m_vertex_shader;
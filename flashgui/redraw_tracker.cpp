@@ -0,0 +1,179 @@
+#include "pch.h"
+#include "redraw_tracker.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace fgui;
+
+void c_redraw_tracker::begin(int width, int height) {
+	if (width != m_width || height != m_height) {
+		m_width = std::max(width, 0);
+		m_height = std::max(height, 0);
+		m_tiles_x = (m_width + tile_size - 1) / tile_size;
+		m_tiles_y = (m_height + tile_size - 1) / tile_size;
+		m_last_tiles.assign(size_t(m_tiles_x) * m_tiles_y, 0);
+		m_invalid = true;
+	}
+
+	m_tiles.assign(size_t(m_tiles_x) * m_tiles_y, fnv1a_64_seed);
+	m_frame_hash = fnv1a_64_seed;
+}
+
+RECT c_redraw_tracker::bounds_of(const shape_instance& inst) {
+	float x0, y0, x1, y1;
+
+	// strokes and AA fringes reach past the geometry
+	float pad = std::fabs(inst.stroke_width) + 2.f;
+
+	// same geometry vertex.hlsl emits, before any late latched cursor offset
+	switch (inst.shape_type & ~cursor_relative_flag) {
+	case 2: // circle, circle outline: half the width around the rect's center, never rotated
+	case 3: {
+		const float r = 0.5f * std::fabs(inst.size.x);
+		const float cx = inst.pos.x + 0.5f * inst.size.x, cy = inst.pos.y + 0.5f * inst.size.y;
+		x0 = cx - r; y0 = cy - r; x1 = cx + r; y1 = cy + r;
+		break;
+	}
+	case 6: // triangle: p1 in uv.xy, p2 in uv.zw, p3 in rotation/stroke_width
+		x0 = std::min({ inst.uv.x, inst.uv.z, inst.rotation });
+		y0 = std::min({ inst.uv.y, inst.uv.w, inst.stroke_width });
+		x1 = std::max({ inst.uv.x, inst.uv.z, inst.rotation });
+		y1 = std::max({ inst.uv.y, inst.uv.w, inst.stroke_width });
+		pad = 2.f;
+		break;
+	case 4: // line: pos is the start, size the end point
+		x0 = std::min(inst.pos.x, inst.size.x);
+		y0 = std::min(inst.pos.y, inst.size.y);
+		x1 = std::max(inst.pos.x, inst.size.x);
+		y1 = std::max(inst.pos.y, inst.size.y);
+		break;
+	default:
+		x0 = inst.pos.x;
+		y0 = inst.pos.y;
+		x1 = inst.pos.x + inst.size.x;
+		y1 = inst.pos.y + inst.size.y;
+
+		if (inst.rotation != 0.f) {
+			// rotated around the center, the circumscribed square covers every angle
+			const float cx = (x0 + x1) * 0.5f, cy = (y0 + y1) * 0.5f;
+			const float r = 0.5f * std::sqrt(inst.size.x * inst.size.x + inst.size.y * inst.size.y);
+			x0 = cx - r; y0 = cy - r; x1 = cx + r; y1 = cy + r;
+		}
+		break;
+	}
+
+	RECT r;
+	r.left = static_cast<LONG>(std::floor(std::min(x0, x1) - pad));
+	r.top = static_cast<LONG>(std::floor(std::min(y0, y1) - pad));
+	r.right = static_cast<LONG>(std::ceil(std::max(x0, x1) + pad));
+	r.bottom = static_cast<LONG>(std::ceil(std::max(y0, y1) + pad));
+	return r;
+}
+
+void c_redraw_tracker::add(const shape_instance* instances, size_t count, uint32_t bucket, const D3D12_RECT* clip) {
+	if (!count)
+		return;
+
+	// the bucket and clip are part of every instance's hash, the same instance drawn elsewhere is a change
+	uint64_t state = fnv1a_64(&bucket, sizeof(bucket));
+	if (clip)
+		state = fnv1a_64(clip, sizeof(D3D12_RECT), state);
+
+	m_frame_hash = fnv1a_64(&state, sizeof(state), m_frame_hash);
+
+	for (size_t i = 0; i < count; ++i) {
+		const shape_instance& inst = instances[i];
+		const uint64_t h = fnv1a_64(&inst, sizeof(shape_instance), state);
+		m_frame_hash = fnv1a_64(&h, sizeof(h), m_frame_hash);
+
+		RECT r = bounds_of(inst);
+		if (clip) {
+			r.left = std::max(r.left, clip->left);
+			r.top = std::max(r.top, clip->top);
+			r.right = std::min(r.right, clip->right);
+			r.bottom = std::min(r.bottom, clip->bottom);
+		}
+
+		r.left = std::max<LONG>(r.left, 0);
+		r.top = std::max<LONG>(r.top, 0);
+		r.right = std::min<LONG>(r.right, m_width);
+		r.bottom = std::min<LONG>(r.bottom, m_height);
+
+		if (r.left >= r.right || r.top >= r.bottom)
+			continue;
+
+		const int tx0 = r.left / tile_size, tx1 = (r.right - 1) / tile_size;
+		const int ty0 = r.top / tile_size, ty1 = (r.bottom - 1) / tile_size;
+
+		for (int ty = ty0; ty <= ty1; ++ty) {
+			uint64_t* row = m_tiles.data() + size_t(ty) * m_tiles_x;
+			for (int tx = tx0; tx <= tx1; ++tx)
+				row[tx] = fnv1a_64(&h, sizeof(h), row[tx]);
+		}
+	}
+}
+
+void c_redraw_tracker::build_dirty_rects(std::vector<RECT>& dirty) const {
+	// runs of changed tiles per row, then rows with the same run stacked into one rect
+	for (int ty = 0; ty < m_tiles_y; ++ty) {
+		const size_t row = size_t(ty) * m_tiles_x;
+
+		for (int tx = 0; tx < m_tiles_x;) {
+			if (m_tiles[row + tx] == m_last_tiles[row + tx]) {
+				++tx;
+				continue;
+			}
+
+			const int start = tx;
+			while (tx < m_tiles_x && m_tiles[row + tx] != m_last_tiles[row + tx])
+				++tx;
+
+			RECT r;
+			r.left = start * tile_size;
+			r.right = std::min(tx * tile_size, m_width);
+			r.top = ty * tile_size;
+			r.bottom = std::min((ty + 1) * tile_size, m_height);
+
+			bool merged = false;
+			for (RECT& d : dirty) {
+				if (d.left == r.left && d.right == r.right && d.bottom == r.top) {
+					d.bottom = r.bottom;
+					merged = true;
+					break;
+				}
+			}
+
+			if (!merged)
+				dirty.push_back(r);
+		}
+	}
+
+	if (dirty.size() > max_dirty_rects) {
+		RECT bounds = dirty.front();
+		for (const RECT& d : dirty) {
+			bounds.left = std::min(bounds.left, d.left);
+			bounds.top = std::min(bounds.top, d.top);
+			bounds.right = std::max(bounds.right, d.right);
+			bounds.bottom = std::max(bounds.bottom, d.bottom);
+		}
+		dirty.assign(1, bounds);
+	}
+}
+
+bool c_redraw_tracker::end(std::vector<RECT>& dirty) {
+	dirty.clear();
+
+	if (!m_invalid && m_frame_hash == m_last_hash)
+		return false;
+
+	const bool full = m_invalid;
+	if (!full)
+		build_dirty_rects(dirty);
+
+	m_invalid = false;
+	m_last_hash = m_frame_hash;
+	m_last_tiles.swap(m_tiles);
+
+	// the list changed but only outside the target (or to the same tiles), nothing visible to present
+	return full || !dirty.empty();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Windows.h>
+#include <cstdint>
+#include <vector>
+#include "dxgicontext.h"
+
+namespace fgui {
+	// Hashes the recorded draw list per frame and per screen tile. An identical frame hash means the
+	// frame can be skipped, tiles whose hash changed become the dirty rects handed to Present1.
+	class c_redraw_tracker {
+	public:
+		static constexpr int tile_size = 64;
+		static constexpr size_t max_dirty_rects = 32; // more than that and one bounding rect is cheaper
+
+		void begin(int width, int height);
+
+		// instances drawn with one font/image, clipped to clip (nullptr = whole target), in draw order
+		void add(const shape_instance* instances, size_t count, uint32_t bucket, const D3D12_RECT* clip);
+
+		// false when the frame is identical to the last one that was kept. Otherwise fills dirty with the
+		// changed regions, left empty when the whole target has to be treated as changed
+		bool end(std::vector<RECT>& dirty);
+
+		// next frame counts as fully changed, for content the draw list can't see (texture reuse, resize)
+		void invalidate() { m_invalid = true; }
+
+		// screen pixels an instance can touch, including stroke and AA fringe
+		static RECT bounds_of(const shape_instance& inst);
+
+	private:
+		void build_dirty_rects(std::vector<RECT>& dirty) const;
+
+		int m_width = 0;
+		int m_height = 0;
+		int m_tiles_x = 0;
+		int m_tiles_y = 0;
+
+		uint64_t m_frame_hash = 0;
+		uint64_t m_last_hash = 0;
+		bool m_invalid = true;
+
+		std::vector<uint64_t> m_tiles;
+		std::vector<uint64_t> m_last_tiles;
+	};
+}
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "renderer.h"
 #include "include/flashgui.h"
+#include "trace.h"
+#include "family_batcher.h"
+#include "instance_culler.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "images/stb_image.h"
@@ -8,8 +11,14 @@
 using namespace fgui;
 
 LRESULT CALLBACK hk::window_procedure(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam) {
-	if (process) {
-		if (process->window_proc(hwnd, msg, wparam, lparam))
+	// c_process passes itself to CreateWindowExA, every later message finds it on the window
+	if (msg == WM_NCCREATE) {
+		const auto create = reinterpret_cast<const CREATESTRUCTA*>(lparam);
+		SetWindowLongPtrA(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(create->lpCreateParams));
+	}
+
+	if (auto owner = reinterpret_cast<c_process*>(GetWindowLongPtrA(hwnd, GWLP_USERDATA))) {
+		if (owner->window_proc(hwnd, msg, wparam, lparam))
 			return true;
 	}
 	return DefWindowProcA(hwnd, msg, wparam, lparam);
@@ -39,6 +48,16 @@ void c_renderer::release_resources() {
 	m_dx->release_resources();
 }
 
+void c_renderer::begin_resize() {
+	m_dx->wait_for_gpu();
+	m_dx->release_backbuffers();
+}
+
+void c_renderer::end_resize() {
+	m_dx->after_external_resize();
+	m_redraw.invalidate();
+}
+
 void c_renderer::create_resources(bool create_heap_and_buffers) {
 
 	if (create_heap_and_buffers)
@@ -51,11 +70,149 @@ int c_renderer::get_fps() const {
 	return m_fps;
 }
 
+texture_heap_stats c_renderer::get_texture_memory_stats() const {
+	return m_dx->fonts->get_texture_heap_stats();
+}
+
+bool c_renderer::write_trace(const std::string& path) const {
+	return trace::write_chrome_trace(path);
+}
+
+void c_renderer::set_gpu_timing(bool enabled, bool per_batch, bool pipeline_stats) {
+	m_dx->gpu_profiler.set_enabled(enabled, per_batch, pipeline_stats);
+}
+
+const frame_timing& c_renderer::get_frame_timing() const {
+	return m_dx->gpu_profiler.get_last_frame();
+}
+
+frame_time_percentiles c_renderer::get_frame_time_percentiles() const {
+	return m_dx->gpu_profiler.get_percentiles();
+}
+
+const frame_wait_stats& c_renderer::get_frame_wait_stats() const {
+	return m_dx->wait_stats;
+}
+
+const pipeline_cache_stats& c_renderer::get_pipeline_cache_stats() const {
+	return m_dx->pipeline_cache.stats();
+}
+
 void c_renderer::wait_for_gpu() {
 	m_dx->wait_for_gpu();
 }
 
+void c_renderer::capture_frame() {
+	m_dx->capture_requested = true;
+}
+
+bool c_renderer::read_frame(image_data& out) {
+	vec2i size;
+	if (!m_dx->read_capture(out.pixels, size))
+		return false;
+
+	// the blend leaves premultiplied color on a transparent target, load_image premultiplies again
+	for (size_t i = 0; i + 3 < out.pixels.size(); i += 4) {
+		const uint32_t a = out.pixels[i + 3];
+		if (a == 0 || a == 255)
+			continue;
+
+		for (size_t c = 0; c < 3; ++c)
+			out.pixels[i + c] = static_cast<uint8_t>(std::min(255u, (out.pixels[i + c] * 255u + a / 2) / a));
+	}
+
+	out.width = size.x;
+	out.height = size.y;
+	out.channels = 4;
+	return true;
+}
+
+void c_renderer::set_latency_mode(latency_mode mode, UINT max_frame_latency) {
+	m_dx->set_frame_latency(mode, max_frame_latency);
+}
+
+void c_renderer::set_pipeline_cache(bool enabled, const std::string& path) {
+	m_dx->use_pipeline_cache = enabled;
+	m_dx->pipeline_cache_path = path;
+}
+
+bool c_renderer::set_vertex_path(vertex_path path) {
+	return m_dx->set_vertex_path(path);
+}
+
+vertex_path c_renderer::get_vertex_path() const {
+	return m_dx->requested_path;
+}
+
+bool c_renderer::set_debug_view(debug_view view) {
+	if (!m_dx->set_debug_view(view))
+		return false;
+
+	// the first frame after switching back has to replace the whole debug picture
+	m_redraw.invalidate();
+	m_dx->dirty_rects.clear();
+	return true;
+}
+
+bool c_renderer::set_tile_mode(tile_mode mode) {
+	if (mode != tile_mode::off && !m_dx->tile_binner.available())
+		return false;
+
+	m_dx->requested_tiles = mode;
+	return true;
+}
+
+tile_mode c_renderer::get_tile_mode() const {
+	return m_dx->tile_binner.available() ? m_dx->requested_tiles : tile_mode::off;
+}
+
+void c_renderer::begin_cursor_follow() {
+	m_cursor_follow = true;
+}
+
+void c_renderer::end_cursor_follow() {
+	m_cursor_follow = false;
+}
+
+uint32_t c_renderer::follow_flag() {
+	// a layer is replayed long after the cursor it was recorded with
+	if (!m_cursor_follow || m_layer)
+		return 0;
+
+	if (m_recording)
+		m_recording->cursor_follow = true;
+	else
+		m_cursor_followed = true;
+	return cursor_relative_flag;
+}
+
+bool c_renderer::set_cull_mode(cull_mode mode) {
+	return m_dx->set_cull_mode(mode);
+}
+
+cull_mode c_renderer::get_cull_mode() const {
+	return m_dx->requested_cull == cull_mode::gpu && !m_dx->instance_culler.available() ? cull_mode::cpu : m_dx->requested_cull;
+}
+
+bool c_renderer::set_gpu_text(bool enabled) {
+	if (enabled && !m_dx->text_expander.available())
+		return false;
+
+	m_gpu_text = enabled;
+	return true;
+}
+
+debug_view c_renderer::get_debug_view() const {
+	return m_dx->requested_debug;
+}
+
+const frame_draw_stats& c_renderer::get_draw_stats() const {
+	return m_dx->draw_stats;
+}
+
 void c_renderer::begin_frame() {
+	FGUI_TRACE_ZONE("renderer::begin_frame");
+
 	// Reset per-frame input flags before processing
 	//process->begin_input_frame();
 
@@ -70,18 +227,96 @@ void c_renderer::begin_frame() {
 	}
 
 	m_dx->begin_frame();
+	m_cursor_followed = false;
+
+	if (on_demand())
+		m_redraw.begin(static_cast<int>(m_dx->viewport.Width), static_cast<int>(m_dx->viewport.Height));
+
+	// free released images whose last use the GPU has finished, if the UI thread is busy
+	// building an atlas don't wait for it, they are collected next frame
+	std::unique_lock<std::recursive_mutex> lock(m_resource_mutex, std::try_to_lock);
+	if (lock.owns_lock())
+		m_dx->fonts->collect_released_images(m_dx->frame_resources, m_dx->frame_index);
 }
 
 //TODO: optimize by multithreading upload and draw calls, optimize draws as well
 void c_renderer::end_frame() {
-	if (process->needs_resize()) {
-		// Reset the resize flag
-		process->resize_complete();
+	FGUI_TRACE_ZONE("renderer::end_frame");
+
+	if (m_viewport)
+		end_viewport();
+
+	if (m_process->needs_resize()) {
+		// the window changed size while this frame was recorded, drop it, begin_frame resizes first thing
+		for (auto& bucket : im_instances)
+			bucket.clear();
+
+		m_dx->skip_frame();
+		m_redraw.invalidate();
 		return;
 	}
 
+	if (on_demand()) {
+		// cursor following instances move without changing, nothing here can tell where they end up.
+		// the tracker only knows the main window, the others are presented whenever they are drawn
+		if (m_cursor_followed || !m_dx->frame_viewports.empty())
+			m_redraw.invalidate();
+		track_instances();
+
+		if (!m_redraw.end(m_dx->dirty_rects)) {
+			for (auto& bucket : im_instances)
+				bucket.clear();
+
+			m_dx->skip_frame();
+			m_presented = false;
+			m_process->end_input_frame();
+			return;
+		}
+	}
+
+	if (m_dx->frame_debug != debug_view::none)
+		draw_debug_overlay();
+
 	m_dx->end_frame(im_instances);
-	process->end_input_frame();
+	m_presented = true;
+	m_process->end_input_frame();
+}
+
+void c_renderer::draw_debug_overlay() {
+	FGUI_TRACE_ZONE("renderer::draw_debug_overlay");
+
+	// the frame's own draws go out first so the counters are complete, the panel is then shaded normally
+	m_dx->flush(im_instances);
+	const frame_draw_stats stats = m_dx->draw_stats;
+	const frame_timing& timing = m_dx->gpu_profiler.get_last_frame();
+	const char* view = m_dx->frame_debug == debug_view::overdraw ? "overdraw" : "batches";
+	m_dx->frame_debug = debug_view::none;
+
+	if (!m_debug_font)
+		m_debug_font = get_font(L"Consolas", 14);
+
+	char lines[10][64];
+	int count = 0;
+	snprintf(lines[count++], 64, "debug view   %s", view);
+	snprintf(lines[count++], 64, "instances    %u", stats.instances);
+	if (stats.tiled_instances)
+		snprintf(lines[count++], 64, "tiled        %u", stats.tiled_instances);
+	if (stats.culled_instances)
+		snprintf(lines[count++], 64, "culled       %u", stats.culled_instances);
+	snprintf(lines[count++], 64, "batches      %u", stats.batches);
+	snprintf(lines[count++], 64, "table binds  %u", stats.descriptor_binds);
+	snprintf(lines[count++], 64, "pso binds    %u", stats.pso_binds);
+	snprintf(lines[count++], 64, "upload       %.1f KB", stats.upload_bytes / 1024.0);
+
+	// GPU numbers lag by the frames in flight
+	snprintf(lines[count++], 64, "gpu / record %.0f / %.0f us", timing.gpu_us, timing.cpu_record_us);
+	if (timing.ps_invocations)
+		snprintf(lines[count++], 64, "px shaded    %llu", static_cast<unsigned long long>(timing.ps_invocations));
+
+	constexpr int line_height = 16;
+	draw_quad({ 8, 8 }, { 230, count * line_height + 12 }, { 0.f, 0.f, 0.f, 0.8f });
+	for (int i = 0; i < count; ++i)
+		draw_text(lines[i], { 16, 14 + i * line_height }, m_debug_font, { 1.f, 1.f, 1.f, 1.f });
 }
 
 void c_renderer::post_present() {
@@ -90,13 +325,17 @@ void c_renderer::post_present() {
 }
 
 font_handle c_renderer::get_font(const std::wstring& family, int size_px, DWRITE_FONT_WEIGHT weight, DWRITE_FONT_STYLE style) {
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
 	bool exists = false;
 	
 	auto handle =
 		m_dx->fonts->get_or_create_font(family, weight, style, size_px, &exists,
-			m_dx->device, m_dx->cmd_queue, m_dx->get_current_frame_resource());
+			m_dx->device, m_dx->cmd_queue);
 
 	if (!exists) {
+		// a new atlas can take over the handle of a released image, same draw list but new texels
+		m_redraw.invalidate();
+
 		// if the font was newly created, we need to add a new vector for its instances
 		if (handle >= im_instances.size()) {
 			im_instances.resize(size_t(handle) + 1ull);
@@ -107,81 +346,578 @@ font_handle c_renderer::get_font(const std::wstring& family, int size_px, DWRITE
 }
 
 void c_renderer::push_clip_rect(vec2i pos, vec2i size) {
-	// Flush current instances before changing scissor
-	m_dx->end_frame(im_instances);
-
 	D3D12_RECT rect{};
 	rect.left = static_cast<long>(pos.x);
 	rect.top = static_cast<long>(pos.y);
 	rect.right = static_cast<long>(pos.x + size.x);
 	rect.bottom = static_cast<long>(pos.y + size.y);
 
-	m_clip_stack.push_back(rect);
+	if (m_recording) {
+		// close the draws under the old clip, the packet's clip table gets the new one
+		seal_packet_draws();
+		m_clip_stack.push_back(rect);
+
+		frame_packet& packet = *m_recording;
+		packet.clips.push_back(rect);
+		m_packet_clip = static_cast<uint32_t>(packet.clips.size() - 1);
+		return;
+	}
 
-	auto& cmd = m_dx->get_current_frame_resource().command_list;
-	cmd->RSSetScissorRects(1, &rect);
+	// Flush current instances before changing scissor
+	if (on_demand())
+		track_instances();
+	m_dx->flush(im_instances);
+
+	m_clip_stack.push_back(rect);
+	m_dx->set_clip(rect);
 }
 
 void c_renderer::pop_clip_rect() {
+	if (m_recording) {
+		seal_packet_draws();
+
+		if (!m_clip_stack.empty())
+			m_clip_stack.pop_back();
+
+		frame_packet& packet = *m_recording;
+		if (m_clip_stack.empty()) {
+			m_packet_clip = packet_draw::no_clip;
+		}
+		else {
+			packet.clips.push_back(m_clip_stack.back());
+			m_packet_clip = static_cast<uint32_t>(packet.clips.size() - 1);
+		}
+		return;
+	}
+
+	// Flush before restoring
+	if (on_demand())
+		track_instances();
+	m_dx->flush(im_instances);
+
 	if (!m_clip_stack.empty())
 		m_clip_stack.pop_back();
 
-	// Flush before restoring
-	m_dx->end_frame(im_instances);
+	m_dx->set_clip(m_clip_stack.empty() ? m_dx->scissor_rect : m_clip_stack.back());
+}
+
+void c_renderer::seal_packet_draws() {
+	frame_packet& packet = *m_recording;
+
+	// instances outside the packet's clip are dropped here, whatever layer or frame replays it uses the same clip.
+	// Without one the scissor is only known when it's drawn
+	const bool cull = m_dx->requested_cull != cull_mode::off && !m_clip_stack.empty();
+
+	// same bucket order a flush would draw in, regrouped by family into the packet's flat instance array
+	for (uint32_t i = 0; i < static_cast<uint32_t>(im_instances.size()); i++) {
+		std::vector<shape_instance>& bucket = im_instances[i];
+		if (cull)
+			cull_instances(bucket, m_clip_stack.back());
+		if (bucket.empty())
+			continue;
+
+		const size_t base = packet.instances.size();
+		packet.instances.resize(base + bucket.size());
+		group_by_family(bucket.data(), bucket.size(), packet.instances.data() + base, m_family_runs, m_dx->group_families);
+
+		for (const family_run& run : m_family_runs)
+			packet.draws.push_back({ i, m_packet_clip, static_cast<uint32_t>(base) + run.start, run.count, run.family });
+		bucket.clear();
+	}
+}
+
+void c_renderer::begin_packet() {
+	FGUI_TRACE_ZONE("renderer::begin_packet");
+
+	m_packets.back().clear();
+	m_packets.back().cursor = m_process->input.mouse_pos;
+	m_clip_stack.clear();
+	m_packet_clip = packet_draw::no_clip;
+	m_recording = &m_packets.back();
+}
+
+void c_renderer::end_packet() {
+	FGUI_TRACE_ZONE("renderer::end_packet");
+
+	seal_packet_draws();
+
+	m_packets.back().sequence = ++m_packet_sequence;
+	m_packets.publish();
+
+	m_recording = nullptr;
+	m_process->end_input_frame();
+}
+
+bool c_renderer::render_packet() {
+	FGUI_TRACE_ZONE("renderer::render_packet");
+
+	begin_frame();
+
+	const frame_packet& packet = m_packets.acquire();
+
+	// the packet's cursor following instances were placed for the cursor when it was built
+	m_dx->cursor_base = packet.cursor;
+
+	if (on_demand()) {
+		if (packet.cursor_follow)
+			m_redraw.invalidate();
+		for (const packet_draw& d : packet.draws)
+			m_redraw.add(&packet.instances[d.start], d.count, d.bucket, d.clip < packet.clips.size() ? &packet.clips[d.clip] : nullptr);
+
+		if (!m_redraw.end(m_dx->dirty_rects)) {
+			m_dx->skip_frame();
+			m_presented = false;
+			return false;
+		}
+	}
+
+	m_dx->draw_packet(packet);
+	m_dx->submit();
+	m_presented = true;
+	return true;
+}
+
+layer_handle c_renderer::create_layer() {
+	for (layer_handle h = 0; h < m_layers.size(); ++h) {
+		if (!m_layers[h]) {
+			m_layers[h] = std::make_unique<static_layer>();
+			return h;
+		}
+	}
+
+	m_layers.push_back(std::make_unique<static_layer>());
+	return static_cast<layer_handle>(m_layers.size() - 1);
+}
+
+static_layer& c_renderer::get_layer(layer_handle h) const {
+	if (h >= m_layers.size() || !m_layers[h])
+		throw std::runtime_error("Invalid layer handle " + std::to_string(h));
+	return *m_layers[h];
+}
+
+bool c_renderer::layer_valid(layer_handle h) const {
+	return get_layer(h).valid;
+}
+
+void c_renderer::invalidate_layer(layer_handle h) {
+	get_layer(h).valid = false;
+}
+
+void c_renderer::release_layer(layer_handle h) {
+	static_layer& layer = get_layer(h);
+	if (&layer == m_layer)
+		throw std::runtime_error("release_layer: layer is still being recorded");
+
+	m_dx->release_layer(layer, true, true);
+	m_layers[h].reset();
+}
+
+void c_renderer::begin_layer(layer_handle h) {
+	FGUI_TRACE_ZONE("renderer::begin_layer");
+	record_layer(get_layer(h));
+}
+
+void c_renderer::record_layer(static_layer& layer) {
+	if (m_layer)
+		throw std::runtime_error("begin_layer: another layer is still being recorded");
+
+	m_layer = &layer;
+	m_layer->packet.clear();
+	m_layer->valid = false;
+
+	// draws already queued for the frame (or packet) stay put, the layer records into empty buckets
+	m_layer_saved.instances.swap(im_instances);
+	im_instances.resize(m_layer_saved.instances.size());
+	m_layer_saved.clips.swap(m_clip_stack);
+	m_layer_saved.recording = m_recording;
+	m_layer_saved.clip = m_packet_clip;
 
-	auto& cmd = m_dx->get_current_frame_resource().command_list;
-	if (m_clip_stack.empty()) {
-		cmd->RSSetScissorRects(1, &m_dx->scissor_rect);
+	m_recording = &m_layer->packet;
+	m_packet_clip = packet_draw::no_clip;
+}
+
+void c_renderer::end_layer() {
+	FGUI_TRACE_ZONE("renderer::end_layer");
+
+	if (!m_layer || (m_panel && m_layer == &m_panel->layer))
+		throw std::runtime_error("end_layer without begin_layer");
+
+	seal_packet_draws();
+
+	// new contents: the bundles are rebuilt, the instance buffer is kept if it is big enough
+	m_layer->valid = true;
+	m_layer->uploaded = false;
+	m_dx->release_layer(*m_layer, false, true);
+	m_layer = nullptr;
+
+	// fonts/images created while recording grew the layer's buckets
+	const size_t buckets = std::max(im_instances.size(), m_layer_saved.instances.size());
+	im_instances.swap(m_layer_saved.instances);
+	im_instances.resize(buckets);
+	m_clip_stack.swap(m_layer_saved.clips);
+	m_layer_saved.clips.clear();
+	m_recording = m_layer_saved.recording;
+	m_packet_clip = m_layer_saved.clip;
+}
+
+void c_renderer::draw_layer(layer_handle h) {
+	FGUI_TRACE_ZONE("renderer::draw_layer");
+
+	static_layer& layer = get_layer(h);
+	if (!layer.valid || layer.packet.draws.empty())
+		return;
+
+	if (m_recording) {
+		// packets (and layers inside layers) replay on another thread or later, take a copy of the draws
+		seal_packet_draws();
+
+		frame_packet& packet = *m_recording;
+		const uint32_t base = static_cast<uint32_t>(packet.instances.size());
+		packet.instances.insert(packet.instances.end(), layer.packet.instances.begin(), layer.packet.instances.end());
+
+		uint32_t src_clip = packet_draw::no_clip, dst_clip = m_packet_clip;
+		for (const packet_draw& d : layer.packet.draws) {
+			if (d.clip != src_clip) {
+				src_clip = d.clip;
+				if (d.clip == packet_draw::no_clip) {
+					dst_clip = m_packet_clip;
+				}
+				else {
+					packet.clips.push_back(layer.packet.clips[d.clip]);
+					dst_clip = static_cast<uint32_t>(packet.clips.size() - 1);
+				}
+			}
+			packet.draws.push_back({ d.bucket, dst_clip, base + d.start, d.count, d.family });
+		}
+		return;
+	}
+
+	if (!m_dx->frame_open)
+		return;
+
+	const D3D12_RECT& scissor = m_clip_stack.empty() ? m_dx->scissor_rect : m_clip_stack.back();
+
+	// the tracker still has to see the layer's instances, on_demand frames pay for hashing them
+	if (on_demand()) {
+		track_instances();
+		for (const packet_draw& d : layer.packet.draws)
+			m_redraw.add(&layer.packet.instances[d.start], d.count, d.bucket, d.clip < layer.packet.clips.size() ? &layer.packet.clips[d.clip] : &scissor);
+	}
+
+	// keep draw order, whatever was queued before the layer goes first
+	m_dx->flush(im_instances);
+	m_dx->draw_layer(layer, scissor);
+}
+
+panel_handle c_renderer::create_panel() {
+	for (panel_handle h = 0; h < m_panels.size(); ++h) {
+		if (!m_panels[h]) {
+			m_panels[h] = std::make_unique<offscreen_panel>();
+			return h;
+		}
+	}
+
+	m_panels.push_back(std::make_unique<offscreen_panel>());
+	return static_cast<panel_handle>(m_panels.size() - 1);
+}
+
+offscreen_panel& c_renderer::get_panel(panel_handle h) const {
+	if (h >= m_panels.size() || !m_panels[h])
+		throw std::runtime_error("Invalid panel handle " + std::to_string(h));
+	return *m_panels[h];
+}
+
+bool c_renderer::panel_valid(panel_handle h) const {
+	return get_panel(h).layer.valid;
+}
+
+void c_renderer::invalidate_panel(panel_handle h) {
+	get_panel(h).layer.valid = false;
+}
+
+void c_renderer::release_panel(panel_handle h) {
+	offscreen_panel& panel = get_panel(h);
+	if (&panel == m_panel)
+		throw std::runtime_error("release_panel: panel is still being recorded");
+
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+	m_dx->release_panel(panel);
+	m_panels[h].reset();
+}
+
+void c_renderer::begin_panel(panel_handle h, vec2i size) {
+	FGUI_TRACE_ZONE("renderer::begin_panel");
+
+	offscreen_panel& panel = get_panel(h);
+	record_layer(panel.layer);
+
+	m_panel = &panel;
+	panel.size = size;
+	panel.rendered = false;
+}
+
+void c_renderer::end_panel() {
+	if (!m_panel)
+		throw std::runtime_error("end_panel without begin_panel");
+
+	// recorded like any layer, end_layer only refuses it so the two can't be mixed up
+	offscreen_panel* panel = m_panel;
+	m_panel = nullptr;
+	end_layer();
+	panel->rendered = false;
+}
+
+void c_renderer::draw_panel(panel_handle h, vec2i pos, DirectX::XMFLOAT4 tint) {
+	FGUI_TRACE_ZONE("renderer::draw_panel");
+
+	offscreen_panel& panel = get_panel(h);
+	if (!panel.layer.valid || panel.size.x <= 0 || panel.size.y <= 0 || m_process->needs_resize())
+		return;
+
+	// packets and layers replay somewhere the target can't be rendered from, they take the draws themselves
+	if (m_recording) {
+		draw_panel_direct(panel, pos, tint);
+		return;
 	}
-	else {
-		cmd->RSSetScissorRects(1, &m_clip_stack.back());
+
+	if (!m_dx->frame_open)
+		return;
+
+	if (!panel.rendered) {
+		std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+
+		const image_handle old_target = panel.target;
+		if (!m_dx->render_panel(panel)) {
+			draw_panel_direct(panel, pos, tint);
+			return;
+		}
+
+		// the quad below hashes the same as before, the tracker has to be told the pixels changed
+		if (panel.target != old_target)
+			ensure_bucket(panel.target);
+		else
+			m_redraw.invalidate();
+	}
+
+	// one texel per pixel, point sampled
+	im_instances.at(panel.target).push_back(shape_instance(
+		pos, panel.size, tint,
+		0.f, 1.f,
+		shape_type::image_quad | follow_flag(),
+		DirectX::XMFLOAT4(0.f, 0.f, 1.f, 1.f)
+	));
+}
+
+namespace {
+	// every point an instance carries, the same fields vertex.hlsl moves for the late latched cursor
+	void translate_instance(fgui::shape_instance& inst, float dx, float dy) {
+		inst.pos.x += dx;
+		inst.pos.y += dy;
+
+		switch (inst.shape_type & ~fgui::cursor_relative_flag) {
+		case 4: // line end point
+			inst.size.x += dx;
+			inst.size.y += dy;
+			break;
+		case 6: // triangle p1, p2 in uv, p3 in rotation/stroke_width
+			inst.uv.x += dx; inst.uv.y += dy;
+			inst.uv.z += dx; inst.uv.w += dy;
+			inst.rotation += dx;
+			inst.stroke_width += dy;
+			break;
+		}
 	}
 }
 
+void c_renderer::draw_panel_direct(const offscreen_panel& panel, vec2i pos, DirectX::XMFLOAT4 tint) {
+	const frame_packet& content = panel.layer.packet;
+	const float dx = static_cast<float>(pos.x), dy = static_cast<float>(pos.y);
+
+	// the panel's own clips are in panel space, all of it stays inside the panel and the caller's clip
+	D3D12_RECT bounds = { static_cast<long>(pos.x), static_cast<long>(pos.y),
+		static_cast<long>(pos.x + panel.size.x), static_cast<long>(pos.y + panel.size.y) };
+	if (!m_clip_stack.empty()) {
+		const D3D12_RECT& outer = m_clip_stack.back();
+		bounds = { std::max(bounds.left, outer.left), std::max(bounds.top, outer.top),
+			std::min(bounds.right, outer.right), std::min(bounds.bottom, outer.bottom) };
+	}
+
+	for (size_t first = 0; first < content.draws.size();) {
+		const uint32_t clip = content.draws[first].clip;
+		size_t last = first;
+		while (last < content.draws.size() && content.draws[last].clip == clip)
+			++last;
+
+		D3D12_RECT r = bounds;
+		if (clip < content.clips.size()) {
+			const D3D12_RECT& c = content.clips[clip];
+			r = { std::max(r.left, c.left + pos.x), std::max(r.top, c.top + pos.y),
+				std::min(r.right, c.right + pos.x), std::min(r.bottom, c.bottom + pos.y) };
+		}
+
+		if (r.right > r.left && r.bottom > r.top) {
+			push_clip_rect({ static_cast<int>(r.left), static_cast<int>(r.top) },
+				{ static_cast<int>(r.right - r.left), static_cast<int>(r.bottom - r.top) });
+
+			for (size_t d = first; d < last; ++d) {
+				const packet_draw& draw = content.draws[d];
+				if (draw.bucket >= im_instances.size())
+					im_instances.resize(size_t(draw.bucket) + 1);
+
+				auto& bucket = im_instances[draw.bucket];
+				for (uint32_t i = 0; i < draw.count; ++i) {
+					bucket.push_back(content.instances[draw.start + i]);
+					shape_instance& inst = bucket.back();
+					translate_instance(inst, dx, dy);
+
+					// scaling all four matches tinting the target's premultiplied texels
+					inst.clr = { inst.clr.x * tint.x, inst.clr.y * tint.y, inst.clr.z * tint.z, inst.clr.w * tint.w };
+				}
+			}
+
+			pop_clip_rect();
+		}
+
+		first = last;
+	}
+}
+
+viewport_handle c_renderer::create_viewport(HWND hwnd) {
+	auto vp = std::make_unique<window_viewport>();
+	vp->hwnd = hwnd;
+	m_dx->create_viewport(*vp);
+
+	for (viewport_handle h = 0; h < m_viewports.size(); ++h) {
+		if (!m_viewports[h]) {
+			m_viewports[h] = std::move(vp);
+			return h;
+		}
+	}
+
+	m_viewports.push_back(std::move(vp));
+	return static_cast<viewport_handle>(m_viewports.size() - 1);
+}
+
+window_viewport& c_renderer::get_viewport(viewport_handle h) const {
+	if (h >= m_viewports.size() || !m_viewports[h])
+		throw std::runtime_error("Invalid viewport handle " + std::to_string(h));
+	return *m_viewports[h];
+}
+
+void c_renderer::release_viewport(viewport_handle h) {
+	window_viewport& vp = get_viewport(h);
+	if (&vp == m_viewport)
+		throw std::runtime_error("release_viewport: viewport is still being drawn");
+
+	m_dx->release_viewport(vp);
+	m_viewports[h].reset();
+}
+
+void c_renderer::begin_viewport(viewport_handle h) {
+	FGUI_TRACE_ZONE("renderer::begin_viewport");
+
+	if (m_recording)
+		throw std::runtime_error("begin_viewport: viewports are drawn in immediate mode, not into packets or layers");
+	if (m_viewport)
+		throw std::runtime_error("begin_viewport: another viewport is still open");
+
+	window_viewport& vp = get_viewport(h);
+	if (!m_dx->frame_open)
+		throw std::runtime_error("begin_viewport outside begin_frame/end_frame");
+
+	// what the main window queued so far is drawn there first
+	if (on_demand())
+		track_instances();
+	m_dx->flush(im_instances);
+
+	m_viewport_clips.swap(m_clip_stack);
+	m_dx->begin_viewport(vp);
+	m_viewport = &vp;
+}
+
+void c_renderer::end_viewport() {
+	FGUI_TRACE_ZONE("renderer::end_viewport");
+
+	if (!m_viewport)
+		throw std::runtime_error("end_viewport without begin_viewport");
+
+	m_dx->flush(im_instances);
+	m_dx->end_viewport();
+	m_viewport = nullptr;
+
+	m_clip_stack.swap(m_viewport_clips);
+	m_viewport_clips.clear();
+}
+
+void c_renderer::track_instances() {
+	const D3D12_RECT* clip = m_clip_stack.empty() ? nullptr : &m_clip_stack.back();
+
+	for (uint32_t i = 0; i < static_cast<uint32_t>(im_instances.size()); i++)
+		m_redraw.add(im_instances[i].data(), im_instances[i].size(), i, clip);
+}
+
+void c_renderer::set_redraw_mode(redraw_mode mode) {
+	m_redraw_mode = mode;
+	m_redraw.invalidate();
+	m_dx->dirty_rects.clear();
+}
+
+void c_renderer::request_redraw() {
+	m_redraw.invalidate();
+}
+
 std::vector<std::wstring> c_renderer::get_font_families() const {
 	return m_dx->fonts->enumerate_families();
 }
 
 void c_renderer::draw_quad(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float outline_width, float rotation) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
-	im_instances.at(0).push_back(shape_instance(pos, size, clr, rotation, outline_width, shape_type::quad));
+	im_instances.at(0).push_back(shape_instance(pos, size, clr, rotation, outline_width, shape_type::quad | follow_flag()));
 }
 
 void c_renderer::draw_line(vec2i start, vec2i end, DirectX::XMFLOAT4 clr, float width) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
-	im_instances.at(0).push_back(shape_instance(start, end, clr, 0.f, width, shape_type::line));
+	im_instances.at(0).push_back(shape_instance(start, end, clr, 0.f, width, shape_type::line | follow_flag()));
 }
 
 void c_renderer::draw_quad_outline(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float width, float rotation) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
-	im_instances.at(0).push_back(shape_instance(pos, size, clr, rotation, width, shape_type::quad_outline));
+	im_instances.at(0).push_back(shape_instance(pos, size, clr, rotation, width, shape_type::quad_outline | follow_flag()));
 }
 
 void c_renderer::draw_circle(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float angle, float outline_width) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
-	im_instances.at(0).push_back(shape_instance(pos, size, clr, angle, outline_width, shape_type::circle));
+	im_instances.at(0).push_back(shape_instance(pos, size, clr, angle, outline_width, shape_type::circle | follow_flag()));
 }
 void c_renderer::draw_circle_outline(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float angle, float outline_width) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
-	im_instances.at(0).push_back(shape_instance(pos, size, clr, angle, outline_width, shape_type::circle_outline));
+	im_instances.at(0).push_back(shape_instance(pos, size, clr, angle, outline_width, shape_type::circle_outline | follow_flag()));
 }
 
 void c_renderer::draw_text(const std::string& text, vec2i pos, const wchar_t* font_family, int px_size, DirectX::XMFLOAT4 clr, DWRITE_FONT_WEIGHT weight, DWRITE_FONT_STYLE style) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
 	font_handle font = get_font(font_family, px_size, weight, style);
 	draw_text(text, pos, font, clr);
 }
 
 void c_renderer::draw_text(const std::string& text, vec2i pos, font_handle font, DirectX::XMFLOAT4 clr) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
 
+	FGUI_TRACE_ZONE("renderer::draw_text");
+
+	// glyphs are laid out on the GPU unless the instances are needed here
+	if (m_gpu_text && m_dx->text_expander.available() && !m_recording && !on_demand() && !m_cursor_follow && font < max_text_fonts) {
+		m_dx->text_expander.queue(text, DirectX::XMFLOAT2(static_cast<float>(pos.x), static_cast<float>(pos.y)), font, clr);
+		return;
+	}
+
 	// use float cursor for sub-pixel advances
 	vec2f cursor = pos;
 
@@ -207,12 +943,15 @@ void c_renderer::draw_text(const std::string& text, vec2i pos, font_handle font,
 		glyph_pos.x += static_cast<float>(glyph.offset_x); // use glyph offset_x so bitmap aligns to pen
 		glyph_pos.y += glyph.offset_y;
 
-		im_instances.at(font).push_back(shape_instance(glyph_pos,
+		// round half up to whole pixels, text_expand.hlsl places GPU runs the same way
+		vec2i glyph_px(static_cast<int>(std::floor(glyph_pos.x + 0.5f)), static_cast<int>(std::floor(glyph_pos.y + 0.5f)));
+
+		im_instances.at(font).push_back(shape_instance(glyph_px,
 			vec2i(glyph_w, glyph_h),
 			clr,
 			0.f,
 			1.f,
-			shape_type::text_quad,
+			shape_type::text_quad | follow_flag(),
 			DirectX::XMFLOAT4(glyph.u0, glyph.v0, glyph.u1, glyph.v1)
 		));
 
@@ -222,7 +961,7 @@ void c_renderer::draw_text(const std::string& text, vec2i pos, font_handle font,
 }
 
 void c_renderer::draw_triangle(vec2i p1, vec2i p2, vec2i p3, DirectX::XMFLOAT4 clr) {
-	if (process->needs_resize())
+	if (m_process->needs_resize())
 		return;
 
 	// Compute bounding box that encloses all three vertices
@@ -239,7 +978,7 @@ void c_renderer::draw_triangle(vec2i p1, vec2i p2, vec2i p3, DirectX::XMFLOAT4 c
 	im_instances.at(0).push_back(shape_instance(
 		bbox_pos, bbox_size, clr,
 		static_cast<float>(p3.x), static_cast<float>(p3.y),
-		shape_type::triangle,
+		shape_type::triangle | follow_flag(),
 		DirectX::XMFLOAT4(
 			static_cast<float>(p1.x), static_cast<float>(p1.y),
 			static_cast<float>(p2.x), static_cast<float>(p2.y)
@@ -247,32 +986,96 @@ void c_renderer::draw_triangle(vec2i p1, vec2i p2, vec2i p3, DirectX::XMFLOAT4 c
 	));
 }
 
-image_handle c_renderer::load_image(const uint8_t* rgba_pixels, uint32_t width, uint32_t height) {
-	image_handle h = m_dx->fonts->load_image_rgba(
-		rgba_pixels, width, height,
-		m_dx->device, m_dx->cmd_queue, m_dx->get_current_frame_resource());
+image_handle c_renderer::load_image(const uint8_t* rgba_pixels, uint32_t width, uint32_t height, bool generate_mips, bool compress) {
+	return load_image(rgba_pixels, width, height, pixel_layout::rgba, generate_mips, compress);
+}
+
+image_handle c_renderer::load_image(const uint8_t* pixels, uint32_t width, uint32_t height, pixel_layout layout, bool generate_mips, bool compress) {
+	if (!pixels || width == 0 || height == 0)
+		throw std::runtime_error("Invalid image data");
+
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+
+	// same source pixels with the same load options share one texture
+	const size_t bytes = size_t(width) * height * px::bytes_per_pixel(layout);
+	const uint32_t flags = (generate_mips ? 1u : 0u) | (compress ? 2u : 0u);
+	const uint32_t params[] = { width, height, static_cast<uint32_t>(layout), flags };
+	const uint64_t hash = fnv1a_64(pixels, bytes, fnv1a_64(params, sizeof(params)));
+	const image_source_key source{ width, height, static_cast<uint32_t>(layout), flags, bytes, fnv1a_64(pixels, bytes, hash) };
+
+	image_handle h = m_dx->fonts->acquire_cached_image(hash, source);
+	if (h != invalid_image)
+		return h;
+
+	// one pass to RGBA + premultiply here so the pixel shader never has to
+	const std::vector<uint8_t> rgba = px::to_premultiplied_rgba(pixels, layout, width, height);
+
+	h = m_dx->fonts->load_image_rgba(
+		rgba.data(), width, height,
+		m_dx->device, m_dx->cmd_queue, generate_mips, compress);
+
+	m_dx->fonts->cache_image(h, {}, hash, source);
+	ensure_bucket(h);
+	return h;
+}
+
+image_handle c_renderer::load_image_dds(const uint8_t* data, size_t size) {
+	const dds_image img = parse_dds(data, size);
+
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+	return load_image_dds(img);
+}
+
+image_handle c_renderer::load_image_dds(const dds_image& img) {
+	// hash the blocks we upload rather than the file, headers can differ for identical textures
+	const uint32_t flags = img.mip_levels;
+	const uint32_t params[] = { img.width, img.height, static_cast<uint32_t>(img.format), flags };
+	const uint64_t hash = fnv1a_64(img.data.data(), img.data.size(), fnv1a_64(params, sizeof(params)));
+	const image_source_key source{ img.width, img.height, static_cast<uint32_t>(img.format), flags, img.data.size(), fnv1a_64(img.data.data(), img.data.size(), hash) };
+
+	image_handle h = m_dx->fonts->acquire_cached_image(hash, source);
+	if (h != invalid_image)
+		return h;
+
+	h = m_dx->fonts->load_image_compressed(
+		img, m_dx->device, m_dx->cmd_queue);
+
+	m_dx->fonts->cache_image(h, {}, hash, source);
+	ensure_bucket(h);
+	return h;
+}
+
+void c_renderer::release_image(image_handle img) {
+	if (img == invalid_image)
+		return;
+
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+	m_dx->fonts->release_image(img);
+}
+
+void c_renderer::ensure_bucket(image_handle h) {
+	// only called for new textures, which may reuse the handle of a released one
+	m_redraw.invalidate();
 
 	// Ensure the instance bucket exists for this handle
 	if (h >= im_instances.size()) {
 		im_instances.resize(size_t(h) + 1);
 	}
-
-	return h;
 }
 
-void c_renderer::draw_image(image_handle img, vec2i pos, vec2i size, DirectX::XMFLOAT4 tint) {
-	if (process->needs_resize())
+void c_renderer::draw_image(image_handle img, vec2i pos, vec2i size, DirectX::XMFLOAT4 tint, image_filter filter) {
+	if (m_process->needs_resize())
 		return;
 
 	if (img >= im_instances.size())
 		return;
 
 	// Full UV rect [0,0]->[1,1] covers the entire image texture
-	// Reuse shape_type 5 (text_quad) since the pixel shader already samples t0 with UV
+	// the shape type selects the sampler in the pixel shader (s0 point, s1 trilinear)
 	im_instances.at(img).push_back(shape_instance(
 		pos, size, tint,
 		0.f, 1.f,
-		shape_type::image_quad,
+		(filter == image_filter::linear ? shape_type::image_quad_linear : shape_type::image_quad) | follow_flag(),
 		DirectX::XMFLOAT4(0.f, 0.f, 1.f, 1.f)
 	));
 }
@@ -288,21 +1091,60 @@ float c_renderer::measure_text_width(const std::string& text, font_handle font)
 
 float c_renderer::measure_text_width(const std::string& text, const wchar_t* font_family, int px_size, DWRITE_FONT_WEIGHT weight, DWRITE_FONT_STYLE style) const {
 	return measure_text_width(text, m_dx->fonts->get_or_create_font(font_family, weight, style, px_size, nullptr,
-		m_dx->device, m_dx->cmd_queue, m_dx->get_current_frame_resource()));
+		m_dx->device, m_dx->cmd_queue));
+}
+
+static bool has_dds_extension(const std::string& path) {
+	if (path.size() < 4)
+		return false;
+
+	std::string ext = path.substr(path.size() - 4);
+	for (char& c : ext)
+		c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+
+	return ext == ".dds";
 }
 
-image_handle c_renderer::load_image(const std::string& path, int desired_channels)
+image_handle c_renderer::load_image(const std::string& path, int desired_channels, bool generate_mips, bool compress)
 {
+	FGUI_TRACE_ZONE("renderer::load_image_file");
+
+	// the load options are part of the key, the same file loaded two ways is two textures
+	const std::string path_key = path + '|' + std::to_string(desired_channels) + (generate_mips ? "m" : "") + (compress ? "c" : "");
+
+	// held across the decode as well, the cache lookup and the insert have to be one step
+	std::lock_guard<std::recursive_mutex> lock(m_resource_mutex);
+
+	image_handle handle = m_dx->fonts->acquire_cached_image(path_key);
+	if (handle != invalid_image)
+		return handle;
+
+	// DDS files are already compressed and carry their own mips
+	if (has_dds_extension(path)) {
+		handle = load_image_dds(load_dds_file(path));
+		m_dx->fonts->cache_image(handle, path_key, 0);
+		return handle;
+	}
+
 	int w, h, ch;
-	uint8_t* data = stbi_load(path.c_str(), &w, &h, &ch, desired_channels);
+	std::unique_ptr<uint8_t, decltype(&stbi_image_free)> data(
+		stbi_load(path.c_str(), &w, &h, &ch, desired_channels), stbi_image_free);
 	
 	if (!data) {
 		throw std::runtime_error("failed to load image: " + path);
 	}
 
-	image_handle handle = load_image(data, static_cast<uint32_t>(w), static_cast<uint32_t>(h));
+	static constexpr pixel_layout layouts[] = { pixel_layout::gray, pixel_layout::gray_alpha, pixel_layout::rgb, pixel_layout::rgba };
+
+	// stb returns desired_channels when one was requested, otherwise whatever the file holds
+	const int channels = desired_channels > 0 ? desired_channels : ch;
+	if (channels < 1 || channels > 4) {
+		throw std::runtime_error("unsupported channel count in image: " + path);
+	}
 
-	stbi_image_free(data);
+	// a different file with identical pixels still resolves to the existing texture through the content hash
+	handle = load_image(data.get(), static_cast<uint32_t>(w), static_cast<uint32_t>(h), layouts[channels - 1], generate_mips, compress);
+	m_dx->fonts->cache_image(handle, path_key, 0);
 
 	return handle;
 }
\ No newline at end of file
@@ -15,6 +15,13 @@
 #include "vec2.h"
 
 #include "fonts.h"
+#include "pixel_convert.h"
+#include "frame_packet.hpp"
+#include "redraw_tracker.h"
+#include "static_layer.hpp"
+#include "offscreen_panel.hpp"
+#include "window_viewport.hpp"
+#include <mutex>
 
 namespace fgui {
 	using Microsoft::WRL::ComPtr;
@@ -25,6 +32,18 @@ namespace fgui {
 		external_overlay
 	};
 
+	// when end_frame actually presents, standalone window only (hooked mode draws into every host frame)
+	enum class redraw_mode {
+		continuous, // every frame
+		on_demand   // only when the draw list changed, with dirty rects for the changed regions
+	};
+
+	// sampler used when drawing an image
+	enum class image_filter {
+		point, // nearest texel, pixel exact at 1:1 scale
+		linear // trilinear, use with images loaded with generate_mips when drawing downscaled
+	};
+
 	struct image_data {
 		int width{};
 		int height{};
@@ -34,11 +53,18 @@ namespace fgui {
 
 	class c_renderer {
 	public:
-		c_renderer(D3D_FEATURE_LEVEL feature_lvl, UINT buffer_count) :
-			m_dx(std::make_unique<s_dxgicontext>(feature_lvl, buffer_count)) {}
+		// draws for process's window (or its offscreen targets when it's headless), which must outlive the renderer.
+		// renderers share nothing, each one can be driven from its own thread
+		c_renderer(c_process* process, D3D_FEATURE_LEVEL feature_lvl, UINT buffer_count) :
+			m_process(process),
+			m_dx(std::make_unique<s_dxgicontext>(feature_lvl, buffer_count)) {
+			m_dx->process = process;
+		}
 
 		~c_renderer() = default;
 
+		c_process* get_process() const { return m_process; }
+
 		void initialize(IDXGISwapChain3* swapchain = nullptr, ID3D12CommandQueue* cmd_queue = nullptr, UINT sync_interval = 1, UINT flags = 0);
 
 		void begin_frame();
@@ -47,9 +73,50 @@ namespace fgui {
 
 		void wait_for_gpu();
 
+		// standalone only: throughput keeps up to max_frame_latency frames queued, low_latency keeps one
+		// can be called before or after initialize, hooked mode leaves the host's swapchain alone
+		void set_latency_mode(latency_mode mode, UINT max_frame_latency = 2);
+
+		// PSO disk cache, call before initialize. On by default under %LOCALAPPDATA%\flashgui, empty path keeps that
+		void set_pipeline_cache(bool enabled, const std::string& path = {});
+
+		// input assembler (default) or vertex pulling, takes effect at the next begin_frame.
+		// returns false and keeps the input assembler when the vertex pulling PSO failed to build
+		bool set_vertex_path(vertex_path path);
+		vertex_path get_vertex_path() const;
+
+		// overdraw heatmap or per draw call colors, with counters drawn in the top left corner. Takes effect at the
+		// next begin_frame and redraws every frame while on. false when the overdraw PSO isn't available
+		bool set_debug_view(debug_view view);
+		debug_view get_debug_view() const;
+
+		// draw_text as one run per call (position, color, raw characters) expanded into glyph quads by a compute
+		// pass, on by default. Packets, layers and on_demand mode keep the CPU path since they need the instances.
+		// false when the text expansion PSO isn't available
+		bool set_gpu_text(bool enabled);
+
+		// bucket 0 (untextured shapes) as instanced quads or binned into 16x16 tiles and shaded by compute,
+		// automatic picks tiles for large buckets of small shapes. false when the tile PSOs aren't available
+		bool set_tile_mode(tile_mode mode);
+		tile_mode get_tile_mode() const;
+
+		// instances outside the viewport and the active clip rect: removed on the CPU before packing (default), by a
+		// compute pass that compacts them and writes the draws for ExecuteIndirect, or not at all. Packets are culled
+		// against their clip on the CPU when they're sealed. false when the cull PSO isn't available
+		bool set_cull_mode(cull_mode mode);
+		cull_mode get_cull_mode() const;
+
+		// instances, draw calls, binds and upload bytes of the frame last recorded, complete after end_frame
+		const frame_draw_stats& get_draw_stats() const;
+
 		void release_resources();
 		void create_resources(bool create_heap_and_buffers = true);
 
+		// hooked mode, around the host's ResizeBuffers: only the backbuffer views are dropped and rebuilt,
+		// frame resources, fences and upload heaps stay alive. Call end_resize even if ResizeBuffers failed
+		void begin_resize();
+		void end_resize();
+
 		//draw functions
 		//shape_instance* add_quad(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float outline_width = 0.f, float rotation = 0.f);
 		//shape_instance* add_quad_outline(vec2i pos, vec2i size, DirectX::XMFLOAT4 clr, float width = 1.f, float rotation = 0.f);
@@ -66,19 +133,109 @@ namespace fgui {
 		void draw_text(const std::string& text, vec2i pos, const wchar_t* font_family, int px_size, DirectX::XMFLOAT4 clr, DWRITE_FONT_WEIGHT = DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE = DWRITE_FONT_STYLE_NORMAL);
 		void draw_text(const std::string& text, vec2i pos, font_handle font, DirectX::XMFLOAT4 clr);
 		void draw_triangle(vec2i p1, vec2i p2, vec2i p3, DirectX::XMFLOAT4 clr);
-		void draw_image(image_handle img, vec2i pos, vec2i size, DirectX::XMFLOAT4 tint = { 1.f, 1.f, 1.f, 1.f });
+		void draw_image(image_handle img, vec2i pos, vec2i size, DirectX::XMFLOAT4 tint = { 1.f, 1.f, 1.f, 1.f }, image_filter filter = image_filter::point);
 
 		float measure_text_width(const std::string& text, font_handle font) const;
 		float measure_text_width(const std::string& text, const wchar_t* font_family, int px_size, DWRITE_FONT_WEIGHT weight = DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE style = DWRITE_FONT_STYLE_NORMAL) const;
 		
+		// Instances drawn between these move with the cursor's travel since the frame was built (since begin_packet
+		// in threaded mode), latched from GetCursorPos right before the GPU gets the frame. For crosshairs, tooltips
+		// and drag previews placed at input.mouse_pos. Ignored while recording a layer, on_demand redraws in full
+		void begin_cursor_follow();
+		void end_cursor_follow();
+
 		// Clip rect stack for scrollable panels
 		void push_clip_rect(vec2i pos, vec2i size);
 		void pop_clip_rect();
 
-		// Load an RGBA image (4 bytes per pixel) and return a handle for drawing
-		image_handle load_image(const uint8_t* rgba_pixels, uint32_t width, uint32_t height);
+		// Threaded mode, the UI thread wraps its draw calls in begin_packet/end_packet at its own rate and
+		// the render thread (or Present hook) calls render_packet, which replays the newest finished packet
+		// instead of waiting for the UI. The two sides exchange packets through a lock-free triple buffer.
+		// Fonts and images may be loaded from the UI thread, release images only after publishing a
+		// packet that no longer draws them.
+		void begin_packet();
+		void end_packet();
+
+		// begin_frame + draw the newest packet + submit, false when nothing was presented (unchanged in on_demand mode)
+		bool render_packet();
+
+		// Static layers: draw calls between begin_layer and end_layer are recorded once into bundles with the
+		// instances in a default heap buffer, draw_layer replays them with ExecuteBundle at that point in the
+		// frame. Re-record only when layer_valid returns false, after invalidate_layer:
+		//   if (!render->layer_valid(chrome)) { render->begin_layer(chrome); ...; render->end_layer(); }
+		//   render->draw_layer(chrome);
+		// Layer clip rects replace the caller's clip, unclipped parts of a layer use it. Recording can happen
+		// inside or outside a frame, in threaded mode draw_layer copies the layer into the packet instead.
+		layer_handle create_layer();
+		void release_layer(layer_handle h);
+		bool layer_valid(layer_handle h) const;
+		void invalidate_layer(layer_handle h);
+		void begin_layer(layer_handle h);
+		void end_layer();
+		void draw_layer(layer_handle h);
+
+		// Cached panels: draws between begin_panel and end_panel are recorded like a static layer, in panel space
+		// ((0, 0) is the panel's top left), rendered into an offscreen texture of the panel's size by the first
+		// draw_panel after each recording and drawn as one image quad on every other frame:
+		//   if (!render->panel_valid(chart)) { render->begin_panel(chart, size); ...; render->end_panel(); }
+		//   render->draw_panel(chart, pos);
+		// A new size gets a new texture. With a multisampled swapchain, in threaded mode and inside layers the
+		// panel's draws are copied in instead, moved to pos and clipped to the panel.
+		panel_handle create_panel();
+		void release_panel(panel_handle h);
+		bool panel_valid(panel_handle h) const;
+		void invalidate_panel(panel_handle h);
+		void begin_panel(panel_handle h, vec2i size);
+		void end_panel();
+		void draw_panel(panel_handle h, vec2i pos, DirectX::XMFLOAT4 tint = { 1.f, 1.f, 1.f, 1.f });
+
+		// Viewports: more OS windows (torn out panels, tool windows) drawn with this renderer's device, fonts,
+		// pipelines and upload heaps, only the swapchain is their own. Draws between begin_viewport and
+		// end_viewport go to that window in its client coordinates, starting from black every frame. Every window
+		// drawn into is recorded into the frame's command list, executed with it and presented after it:
+		//   render->begin_frame(); ...; render->begin_viewport(tool); ...; render->end_viewport(); render->end_frame();
+		// Immediate mode only. The caller owns the window and releases the viewport before destroying it.
+		// Frames that draw a viewport are never skipped by on_demand mode.
+		viewport_handle create_viewport(HWND hwnd);
+		void release_viewport(viewport_handle h);
+		void begin_viewport(viewport_handle h);
+		void end_viewport();
+
+		// on_demand skips frames whose draw list hashes the same as the last presented one
+		void set_redraw_mode(redraw_mode mode);
+
+		// present the next frame in full even if the draw list didn't change
+		void request_redraw();
+
+		// false when the last frame was skipped, an idle loop can block on window messages until then
+		bool frame_presented() const { return m_presented; }
+
+		// copy the next submitted frame's back buffer out, read_frame blocks until the GPU has written it and
+		// returns it as straight alpha RGBA8, ready for load_image. Meant for headless renderers but works in
+		// every mode, false when nothing was captured, the swapchain is multisampled or it isn't 8 bit RGBA/BGRA
+		void capture_frame();
+		bool read_frame(image_data& out);
 
-		image_handle load_image(const std::string& path, int desired_channels = 4);
+		// Load an RGBA image (4 bytes per pixel, straight alpha) and return a handle for drawing
+		// generate_mips builds a mip chain so images drawn smaller than their size sample a smaller level
+		// compress encodes to BC1/BC3 at load time (4-8x less VRAM), needs width and height to be multiples of 4
+		image_handle load_image(const uint8_t* rgba_pixels, uint32_t width, uint32_t height, bool generate_mips = false, bool compress = false);
+
+		// Same as above for any source layout, converted to premultiplied RGBA once at load
+		image_handle load_image(const uint8_t* pixels, uint32_t width, uint32_t height, pixel_layout layout, bool generate_mips = false, bool compress = false);
+
+		// .dds files are uploaded as-is (BC1/BC3/BC4/BC7, mips from the file), everything else goes through stb_image.
+		// Straight alpha BC3/BC7 (anything but DXT4 or a DX10 header saying premultiplied) is premultiplied at load
+		// desired_channels = 0 keeps the file's own channel count and expands it on our side
+		image_handle load_image(const std::string& path, int desired_channels = 4, bool generate_mips = false, bool compress = false);
+
+		// Load a DDS file already in memory
+		image_handle load_image_dds(const uint8_t* data, size_t size);
+
+		// Every load_image call returns a reference, loading the same path or the same pixels again returns
+		// the existing handle with one more reference. Release each one when done, the texture and its
+		// descriptor are freed after the last release once the GPU no longer uses them.
+		void release_image(image_handle img);
 		
 		font_handle get_font(const std::wstring& family,
 			int size_px,
@@ -88,6 +245,28 @@ namespace fgui {
 		std::vector<std::wstring> get_font_families() const;
 
 		int get_fps() const;
+
+		// texture heap usage/fragmentation, useful to watch while loading and releasing images
+		texture_heap_stats get_texture_memory_stats() const;
+
+		// time begin_frame spent waiting for the GPU or the swapchain before reusing a frame resource
+		const frame_wait_stats& get_frame_wait_stats() const;
+
+		// whether the PSOs came from the disk cache and how long pipeline creation took at initialize
+		const pipeline_cache_stats& get_pipeline_cache_stats() const;
+
+		// CPU trace zones of every thread as Chrome trace JSON, empty unless built with FGUI_ENABLE_TRACE
+		bool write_trace(const std::string& path) const;
+
+		// GPU timestamps around the overlay's command list, on by default, per_batch adds a pair per draw.
+		// pipeline_stats also counts pixel shader invocations (frame_timing::ps_invocations) to measure overdraw
+		void set_gpu_timing(bool enabled, bool per_batch = false, bool pipeline_stats = false);
+
+		// newest frame whose timestamps have been read back, lags the current frame by the frames in flight
+		const frame_timing& get_frame_timing() const;
+
+		// p50/p95/p99 in microseconds over the last 512 resolved frames
+		frame_time_percentiles get_frame_time_percentiles() const;
 	private:
 
 		enum shape_type : int {
@@ -99,9 +278,13 @@ namespace fgui {
 			text_quad			= 5,
 			triangle			= 6,
 			triangle_outline	= 7,
-			image_quad			= 8
+			image_quad			= 8,
+			image_quad_linear	= 9
 		};
 
+		void ensure_bucket(image_handle h);
+		image_handle load_image_dds(const dds_image& img);
+
 		//immediate instances, cleared every frame, used for text and other shapes that need to be updated every frame
 		//indexed by font handle
 		std::vector<std::vector<shape_instance>> im_instances;
@@ -110,10 +293,59 @@ namespace fgui {
 
 		std::vector<D3D12_RECT> m_clip_stack;
 
+		void seal_packet_draws();
+		static_layer& get_layer(layer_handle h) const;
+		void record_layer(static_layer& layer); // begin_layer/begin_panel
+		offscreen_panel& get_panel(panel_handle h) const;
+		void draw_panel_direct(const offscreen_panel& panel, vec2i pos, DirectX::XMFLOAT4 tint); // when the target can't be used
+		window_viewport& get_viewport(viewport_handle h) const;
+
+		bool on_demand() const { return m_redraw_mode == redraw_mode::on_demand && !m_dx->hooked && !m_dx->headless && m_dx->requested_debug == debug_view::none; }
+		void track_instances();
+		void draw_debug_overlay();
+		font_handle m_debug_font = 0;
+
+		redraw_mode m_redraw_mode = redraw_mode::continuous;
+		c_redraw_tracker m_redraw;
+		bool m_presented = true;
+		bool m_gpu_text = true;
+
+		bool m_cursor_follow = false;   // between begin/end_cursor_follow
+		bool m_cursor_followed = false; // the frame has cursor following instances
+		uint32_t follow_flag(); // cursor_relative_flag for new instances, marks the frame or packet as following
+
+		c_packet_exchange m_packets;
+		frame_packet* m_recording = nullptr; // packet or layer draws are sealed into, null = straight to the command list
+		uint32_t m_packet_clip = packet_draw::no_clip; // clip table index new draws use
+		std::vector<family_run> m_family_runs; // seal_packet_draws scratch
+		uint64_t m_packet_sequence = 0;
+
+		std::vector<std::unique_ptr<static_layer>> m_layers; // indexed by layer_handle, null = free
+		static_layer* m_layer = nullptr; // being recorded
+
+		std::vector<std::unique_ptr<offscreen_panel>> m_panels; // indexed by panel_handle, null = free
+		offscreen_panel* m_panel = nullptr; // being recorded, its layer is m_layer
+
+		std::vector<std::unique_ptr<window_viewport>> m_viewports; // indexed by viewport_handle, null = free
+		window_viewport* m_viewport = nullptr; // between begin/end_viewport
+		std::vector<D3D12_RECT> m_viewport_clips; // the main window's clip stack meanwhile
+
+		// frame state put aside while a layer records
+		struct {
+			std::vector<std::vector<shape_instance>> instances;
+			std::vector<D3D12_RECT> clips;
+			frame_packet* recording = nullptr;
+			uint32_t clip = packet_draw::no_clip;
+		} m_layer_saved;
+
+		// fonts/images are created on the UI thread and retired on the render thread in threaded mode
+		std::recursive_mutex m_resource_mutex;
+
 		uint32_t m_frame_count = 0; // Total frame count this second
 		int m_fps = 0; // FPS value
 		std::chrono::steady_clock::time_point m_last_fps_update; // Last time FPS was updated
 
+		c_process* m_process = nullptr; // window size and input, not owned
 		std::unique_ptr<s_dxgicontext> m_dx; // DXGI context containing factory, adapter, device, command queue, and swapchain
 
 		render_mode m_mode = render_mode::external_window; // Current rendering mode
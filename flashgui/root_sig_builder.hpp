@@ -176,8 +176,14 @@ namespace fgui {
         }
            
         
-        // safe configuration
-        ComPtr<ID3D12RootSignature> build_safe() {
+        // safe configuration. vertex_pulling drops the input layout and adds b1 (instance base, 1 constant)
+        // and a root SRV at t0 space1 for the instance buffer, both vertex only
+        // root CBV b2 of build_safe's signatures (vertex.hlsl's LatchCB), after the vertex pulling parameters
+        static constexpr UINT latch_param(bool vertex_pulling) {
+            return vertex_pulling ? 4 : 2;
+        }
+
+        ComPtr<ID3D12RootSignature> build_safe(bool vertex_pulling = false) {
             if (!m_device) {
                 throw std::runtime_error("Invalid D3D12 device");
             }
@@ -189,7 +195,7 @@ namespace fgui {
             srv_range.RegisterSpace = 0;
             srv_range.OffsetInDescriptorsFromTableStart = 0;
 
-            D3D12_ROOT_PARAMETER params[2] = {};
+            D3D12_ROOT_PARAMETER params[5] = {};
 
             params[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
             params[0].Constants.ShaderRegister = 0; // b0
@@ -202,25 +208,49 @@ namespace fgui {
             params[1].DescriptorTable.pDescriptorRanges = &srv_range;
             params[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
-            D3D12_STATIC_SAMPLER_DESC sampler{};
-            sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_POINT;
-            sampler.AddressU = sampler.AddressV = sampler.AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
-            sampler.ComparisonFunc = D3D12_COMPARISON_FUNC_ALWAYS;
-            sampler.MaxLOD = D3D12_FLOAT32_MAX;
-            sampler.ShaderRegister = 0; // s0
-            sampler.RegisterSpace = 0;
-            sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+            params[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+            params[2].Constants.ShaderRegister = 1; // b1
+            params[2].Constants.RegisterSpace = 0;
+            params[2].Constants.Num32BitValues = 1;
+            params[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+            params[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+            params[3].Descriptor.ShaderRegister = 0; // t0, space1
+            params[3].Descriptor.RegisterSpace = 1;
+            params[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+            // late latched values, written by the CPU right before the frame is executed
+            D3D12_ROOT_PARAMETER& latch = params[latch_param(vertex_pulling)];
+            latch = {};
+            latch.ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+            latch.Descriptor.ShaderRegister = 2; // b2
+            latch.Descriptor.RegisterSpace = 0;
+            latch.ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+            // s0 = point (glyph atlases, pixel exact images), s1 = trilinear (minified images with mips)
+            D3D12_STATIC_SAMPLER_DESC samplers[2] = {};
+            for (UINT i = 0; i < 2; ++i) {
+                samplers[i].AddressU = samplers[i].AddressV = samplers[i].AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+                samplers[i].ComparisonFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+                samplers[i].MaxLOD = D3D12_FLOAT32_MAX;
+                samplers[i].ShaderRegister = i; // s0, s1
+                samplers[i].RegisterSpace = 0;
+                samplers[i].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+            }
+            samplers[0].Filter = D3D12_FILTER_MIN_MAG_MIP_POINT;
+            samplers[1].Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
 
             D3D12_ROOT_SIGNATURE_DESC desc{};
-            desc.NumParameters = 2;
+            desc.NumParameters = latch_param(vertex_pulling) + 1;
             desc.pParameters = params;
-            desc.NumStaticSamplers = 1;
-            desc.pStaticSamplers = &sampler;
+            desc.NumStaticSamplers = 2;
+            desc.pStaticSamplers = samplers;
             desc.Flags =
-                D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT |
                 D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS |
                 D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS |
                 D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS;
+            if (!vertex_pulling)
+                desc.Flags |= D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
             ComPtr<ID3DBlob> sig;
             ComPtr<ID3DBlob> error;
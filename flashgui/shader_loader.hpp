@@ -11,6 +11,28 @@
 
 #include "shaders/quad_ps.h"
 #include "shaders/quad_vs.h"
+#include "shaders/quad_vs_pull.h"
+
+// pixel shader permutations per shape family
+#include "shaders/quad_ps_shapes.h"
+#include "shaders/quad_ps_circles.h"
+#include "shaders/quad_ps_text.h"
+#include "shaders/quad_ps_images.h"
+
+// overdraw debug view (overdraw.hlsl)
+#include "shaders/quad_ps_overdraw.h"
+
+// text run expansion compute shader (text_expand.hlsl)
+#include "shaders/text_cs.h"
+
+// tile path (tiles.hlsl), bin + shade compute and the composite pass
+#include "shaders/tile_bin_cs.h"
+#include "shaders/tile_shade_cs.h"
+#include "shaders/tile_composite_vs.h"
+#include "shaders/tile_composite_ps.h"
+
+// clip culling compute shader (cull.hlsl)
+#include "shaders/cull_cs.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -36,8 +58,46 @@ namespace fgui {
             throw_if_failed(D3DCreateBlob(g_quad_ps_length, &m_ps_blob));
             memcpy(m_ps_blob->GetBufferPointer(), &g_quad_ps, g_quad_ps_length);
 
+            // load vertex pulling VS bytecode
+            throw_if_failed(D3DCreateBlob(g_quad_vs_pull_length, &m_vs_pull_blob));
+            memcpy(m_vs_pull_blob->GetBufferPointer(), &g_quad_vs_pull, g_quad_vs_pull_length);
+
+            // same order as fgui::ps_family, slot 0 (generic) is m_ps_blob
+            const shader_bytecode families[] = {
+                { g_quad_ps_shapes, g_quad_ps_shapes_length },
+                { g_quad_ps_circles, g_quad_ps_circles_length },
+                { g_quad_ps_text, g_quad_ps_text_length },
+                { g_quad_ps_images, g_quad_ps_images_length },
+            };
+            for (size_t i = 0; i < 4; ++i) {
+                throw_if_failed(D3DCreateBlob(families[i].size, &m_ps_family_blobs[i + 1]));
+                memcpy(m_ps_family_blobs[i + 1]->GetBufferPointer(), families[i].data, families[i].size);
+            }
+            m_ps_family_blobs[0] = m_ps_blob;
+
+            throw_if_failed(D3DCreateBlob(g_quad_ps_overdraw_length, &m_ps_overdraw_blob));
+            memcpy(m_ps_overdraw_blob->GetBufferPointer(), &g_quad_ps_overdraw, g_quad_ps_overdraw_length);
+
+            throw_if_failed(D3DCreateBlob(g_text_cs_length, &m_cs_text_blob));
+            memcpy(m_cs_text_blob->GetBufferPointer(), &g_text_cs, g_text_cs_length);
+
+            const shader_bytecode tiles[] = {
+                { g_tile_bin_cs, g_tile_bin_cs_length },
+                { g_tile_shade_cs, g_tile_shade_cs_length },
+                { g_tile_composite_vs, g_tile_composite_vs_length },
+                { g_tile_composite_ps, g_tile_composite_ps_length },
+            };
+            ComPtr<ID3DBlob>* tile_blobs[] = { &m_cs_tile_bin_blob, &m_cs_tile_shade_blob, &m_vs_tile_composite_blob, &m_ps_tile_composite_blob };
+            for (size_t i = 0; i < 4; ++i) {
+                throw_if_failed(D3DCreateBlob(tiles[i].size, tile_blobs[i]->ReleaseAndGetAddressOf()));
+                memcpy((*tile_blobs[i])->GetBufferPointer(), tiles[i].data, tiles[i].size);
+            }
+
+            throw_if_failed(D3DCreateBlob(g_cull_cs_length, &m_cs_cull_blob));
+            memcpy(m_cs_cull_blob->GetBufferPointer(), &g_cull_cs, g_cull_cs_length);
+
             std::cout << "[Shader Loader] Bytecode loaded: VS=" << g_quad_vs_length
-                << "B PS=" << g_quad_ps_length << "B\n";
+                << "B PS=" << g_quad_ps_length << "B VS(pull)=" << g_quad_vs_pull_length << "B\n";
         }
 
         D3D12_SHADER_BYTECODE get_vs() const {
@@ -52,6 +112,48 @@ namespace fgui {
             return m_ps_blob;
 		}
 
+        // pixel shader for a fgui::ps_family index, null past the last family
+        ComPtr<ID3DBlob> get_ps_family_blob(size_t family) const {
+            return family < 5 ? m_ps_family_blobs[family] : nullptr;
+        }
+
+        // text run expansion compute shader
+        ComPtr<ID3DBlob> get_cs_text_blob() const {
+            return m_cs_text_blob;
+        }
+
+        // tile path shaders (tiles.hlsl)
+        ComPtr<ID3DBlob> get_cs_tile_bin_blob() const {
+            return m_cs_tile_bin_blob;
+        }
+
+        ComPtr<ID3DBlob> get_cs_tile_shade_blob() const {
+            return m_cs_tile_shade_blob;
+        }
+
+        ComPtr<ID3DBlob> get_vs_tile_composite_blob() const {
+            return m_vs_tile_composite_blob;
+        }
+
+        ComPtr<ID3DBlob> get_ps_tile_composite_blob() const {
+            return m_ps_tile_composite_blob;
+        }
+
+        // clip culling compute shader
+        ComPtr<ID3DBlob> get_cs_cull_blob() const {
+            return m_cs_cull_blob;
+        }
+
+        // additive heat shader for the overdraw debug view
+        ComPtr<ID3DBlob> get_ps_overdraw_blob() const {
+            return m_ps_overdraw_blob;
+        }
+
+        // SV_VertexID variant of the VS, no input layout
+        ComPtr<ID3DBlob> get_vs_pull_blob() const {
+            return m_vs_pull_blob;
+        }
+
         D3D12_SHADER_BYTECODE get_ps() const {
             return { m_ps_blob->GetBufferPointer(), m_ps_blob->GetBufferSize() };
         }
@@ -69,6 +171,8 @@ namespace fgui {
         }
 
         ComPtr<ID3D12Device> m_device;
-        ComPtr<ID3DBlob> m_vs_blob, m_ps_blob;
+        ComPtr<ID3DBlob> m_vs_blob, m_ps_blob, m_vs_pull_blob, m_ps_overdraw_blob, m_cs_text_blob, m_cs_cull_blob;
+        ComPtr<ID3DBlob> m_ps_family_blobs[5];
+        ComPtr<ID3DBlob> m_cs_tile_bin_blob, m_cs_tile_shade_blob, m_vs_tile_composite_blob, m_ps_tile_composite_blob;
     };
 }
\ No newline at end of file
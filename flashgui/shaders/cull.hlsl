@@ -0,0 +1,128 @@
+// Clip culling for flush: one thread group per 256 instance chunk of a draw. Instances whose bounds miss the
+// clip are dropped, the rest are compacted in order to the start of their chunk in visible, and the chunk's
+// draw arguments are written for ExecuteIndirect. Empty chunks still get their (zero instance) arguments,
+// the CPU never reads the counts back.
+
+// matches fgui::shape_instance, structured buffers are tightly packed (60 byte stride)
+struct shape_instance
+{
+    float2 pos;
+    float2 size;
+    float rotation;
+    float stroke_width;
+    float4 clr;
+    uint shape_type;
+    float4 uv;
+};
+
+#define CULL_CHUNK 256 // fgui::cull_chunk
+#define CURSOR_RELATIVE 0x80000000u // fgui::cursor_relative_flag, moved after culling so always kept
+
+cbuffer CullCB : register(b0)
+{
+    int4 clip;           // left, top, right, bottom: the scissor within the viewport
+    uint first_instance; // the draw's start, relative to instances
+    uint instance_count;
+    uint first_slot;     // argument slot of the draw's first chunk
+    uint pull_layout;    // 1: instance_base constant + DrawInstanced (vertex pulling), 0: DrawIndexedInstanced
+};
+
+StructuredBuffer<shape_instance> instances : register(t0);
+RWStructuredBuffer<shape_instance> visible : register(u0); // same indices as instances
+RWByteAddressBuffer args : register(u1);                   // 20 bytes per slot, both layouts
+
+groupshared uint scan[CULL_CHUNK];
+
+// fgui::c_redraw_tracker::bounds_of, x0 y0 x1 y1
+float4 instance_bounds(shape_instance inst)
+{
+    float pad = abs(inst.stroke_width) + 2.0f;
+    float2 lo, hi;
+
+    if (inst.shape_type == 2 || inst.shape_type == 3)
+    {
+        float radius = 0.5f * abs(inst.size.x);
+        float2 center = inst.pos + 0.5f * inst.size;
+        lo = center - radius;
+        hi = center + radius;
+    }
+    else if (inst.shape_type == 6)
+    {
+        float2 p1 = inst.uv.xy, p2 = inst.uv.zw, p3 = float2(inst.rotation, inst.stroke_width);
+        lo = min(p1, min(p2, p3));
+        hi = max(p1, max(p2, p3));
+        pad = 2.0f;
+    }
+    else if (inst.shape_type == 4)
+    {
+        lo = min(inst.pos, inst.size);
+        hi = max(inst.pos, inst.size);
+    }
+    else
+    {
+        lo = min(inst.pos, inst.pos + inst.size);
+        hi = max(inst.pos, inst.pos + inst.size);
+
+        if (inst.rotation != 0.0f)
+        {
+            // rotated around the center, the circumscribed square covers every angle
+            float2 center = 0.5f * (lo + hi);
+            float radius = 0.5f * length(inst.size);
+            lo = center - radius;
+            hi = center + radius;
+        }
+    }
+
+    return float4(floor(lo - pad), ceil(hi + pad));
+}
+
+[numthreads(CULL_CHUNK, 1, 1)]
+void main(uint3 group : SV_GroupID, uint index : SV_GroupIndex)
+{
+    uint chunk_start = first_instance + group.x * CULL_CHUNK;
+    uint chunk_count = min(CULL_CHUNK, first_instance + instance_count - chunk_start);
+
+    shape_instance inst = (shape_instance)0;
+    uint keep = 0;
+    if (index < chunk_count)
+    {
+        inst = instances[chunk_start + index];
+        float4 bounds = instance_bounds(inst);
+        bool inside = bounds.x < clip.z && bounds.z > clip.x && bounds.y < clip.w && bounds.w > clip.y;
+        keep = inside || (inst.shape_type & CURSOR_RELATIVE) != 0 ? 1 : 0;
+    }
+
+    // inclusive prefix sum, a kept instance's slot is its sum - 1
+    scan[index] = keep;
+    GroupMemoryBarrierWithGroupSync();
+
+    for (uint offset = 1; offset < CULL_CHUNK; offset <<= 1)
+    {
+        uint add = index >= offset ? scan[index - offset] : 0;
+        GroupMemoryBarrierWithGroupSync();
+        scan[index] += add;
+        GroupMemoryBarrierWithGroupSync();
+    }
+
+    if (keep)
+        visible[chunk_start + scan[index] - 1] = inst;
+
+    if (index == CULL_CHUNK - 1)
+    {
+        uint count = scan[index];
+        uint address = (first_slot + group.x) * 20;
+
+        if (pull_layout)
+        {
+            // instance_base (root constant), then D3D12_DRAW_ARGUMENTS
+            args.Store4(address, uint4(chunk_start, 6, count, 0));
+            args.Store(address + 16, 0);
+        }
+        else
+        {
+            // D3D12_DRAW_INDEXED_ARGUMENTS, the chunk's start as StartInstanceLocation
+            args.Store4(address, uint4(6, count, 0, 0));
+            args.Store(address + 16, chunk_start);
+        }
+    }
+}
@@ -1,36 +1,205 @@
 @echo off
 setlocal
 
+REM Compiles every shader to DXIL with dxc and embeds the bytecode as C arrays (bin2c).
+REM flashgui.vcxproj runs this as its pre-build step into $(IntDir)shaders, CMake builds compile
+REM the same list through fgui_add_shader. dxc.exe needs dxcompiler.dll next to it or on PATH
+
+IF "%~1"=="" (
+    echo usage: hlsl_to_c_files.bat ^<output dir^>
+    exit /b 1
+)
+
+set "OUT=%~f1"
+IF NOT EXIST "%OUT%" mkdir "%OUT%"
+cd /d "%~dp0"
+
 REM ==== Compile HLSL to CSO ====
 
 dxc.exe ^
   -T ps_6_0 ^
   -E main ^
-  -Fo quad_ps.cso ^
+  -Fo "%OUT%\quad_ps.cso" ^
   pixel.hlsl
 
 IF ERRORLEVEL 1 (
     echo Pixel shader compile failed.
-    pause
     exit /b 1
 )
 
 dxc.exe ^
   -T vs_6_0 ^
   -E main ^
-  -Fo quad_vs.cso ^
+  -Fo "%OUT%\quad_vs.cso" ^
   vertex.hlsl
 
 IF ERRORLEVEL 1 (
     echo Vertex shader compile failed.
-    pause
     exit /b 1
 )
 
-REM ==== Convert CSO -> extensionless files ====
+dxc.exe ^
+  -T vs_6_0 ^
+  -E main ^
+  -Fo "%OUT%\quad_vs_pull.cso" ^
+  vertex_pull.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Vertex pulling shader compile failed.
+    exit /b 1
+)
+
+REM ==== Pixel shader permutations, one family each (see the top of pixel.hlsl) ====
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E main ^
+  -D FGUI_PS_SHAPES=1 -D FGUI_PS_CIRCLES=0 -D FGUI_PS_TEXT=0 -D FGUI_PS_IMAGES=0 ^
+  -Fo "%OUT%\quad_ps_shapes.cso" ^
+  pixel.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Pixel shader permutation shapes compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E main ^
+  -D FGUI_PS_SHAPES=0 -D FGUI_PS_CIRCLES=1 -D FGUI_PS_TEXT=0 -D FGUI_PS_IMAGES=0 ^
+  -Fo "%OUT%\quad_ps_circles.cso" ^
+  pixel.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Pixel shader permutation circles compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E main ^
+  -D FGUI_PS_SHAPES=0 -D FGUI_PS_CIRCLES=0 -D FGUI_PS_TEXT=1 -D FGUI_PS_IMAGES=0 ^
+  -Fo "%OUT%\quad_ps_text.cso" ^
+  pixel.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Pixel shader permutation text compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E main ^
+  -D FGUI_PS_SHAPES=0 -D FGUI_PS_CIRCLES=0 -D FGUI_PS_TEXT=0 -D FGUI_PS_IMAGES=1 ^
+  -Fo "%OUT%\quad_ps_images.cso" ^
+  pixel.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Pixel shader permutation images compile failed.
+    exit /b 1
+)
+
+REM ==== Overdraw debug view ====
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E main ^
+  -Fo "%OUT%\quad_ps_overdraw.cso" ^
+  overdraw.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Overdraw shader compile failed.
+    exit /b 1
+)
+
+REM ==== Text run expansion (compute) ====
+
+dxc.exe ^
+  -T cs_6_0 ^
+  -E main ^
+  -Fo "%OUT%\text_cs.cso" ^
+  text_expand.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Text expansion shader compile failed.
+    exit /b 1
+)
+
+REM ==== Tile path (compute binning + shading, composite) ====
+
+dxc.exe ^
+  -T cs_6_0 ^
+  -E bin_main ^
+  -Fo "%OUT%\tile_bin_cs.cso" ^
+  tiles.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Tile binning shader compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T cs_6_0 ^
+  -E shade_main ^
+  -Fo "%OUT%\tile_shade_cs.cso" ^
+  tiles.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Tile shading shader compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T vs_6_0 ^
+  -E composite_vs ^
+  -Fo "%OUT%\tile_composite_vs.cso" ^
+  tiles.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Tile composite vertex shader compile failed.
+    exit /b 1
+)
+
+dxc.exe ^
+  -T ps_6_0 ^
+  -E composite_ps ^
+  -Fo "%OUT%\tile_composite_ps.cso" ^
+  tiles.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Tile composite pixel shader compile failed.
+    exit /b 1
+)
+
+REM ==== Clip culling (compute, ExecuteIndirect arguments) ====
+
+dxc.exe ^
+  -T cs_6_0 ^
+  -E main ^
+  -Fo "%OUT%\cull_cs.cso" ^
+  cull.hlsl
+
+IF ERRORLEVEL 1 (
+    echo Cull shader compile failed.
+    exit /b 1
+)
+
+REM ==== Convert CSO -> C arrays, next to the CSO ====
 
-bin2c.exe quad_ps.cso quad_ps quad_ps
-bin2c.exe quad_vs.cso quad_vs quad_vs
+cd /d "%OUT%"
+"%~dp0bin2c.exe" quad_ps.cso quad_ps quad_ps
+"%~dp0bin2c.exe" quad_vs.cso quad_vs quad_vs
+"%~dp0bin2c.exe" quad_vs_pull.cso quad_vs_pull quad_vs_pull
+"%~dp0bin2c.exe" quad_ps_shapes.cso quad_ps_shapes quad_ps_shapes
+"%~dp0bin2c.exe" quad_ps_circles.cso quad_ps_circles quad_ps_circles
+"%~dp0bin2c.exe" quad_ps_text.cso quad_ps_text quad_ps_text
+"%~dp0bin2c.exe" quad_ps_images.cso quad_ps_images quad_ps_images
+"%~dp0bin2c.exe" quad_ps_overdraw.cso quad_ps_overdraw quad_ps_overdraw
+"%~dp0bin2c.exe" text_cs.cso text_cs text_cs
+"%~dp0bin2c.exe" tile_bin_cs.cso tile_bin_cs tile_bin_cs
+"%~dp0bin2c.exe" tile_shade_cs.cso tile_shade_cs tile_shade_cs
+"%~dp0bin2c.exe" tile_composite_vs.cso tile_composite_vs tile_composite_vs
+"%~dp0bin2c.exe" tile_composite_ps.cso tile_composite_ps tile_composite_ps
+"%~dp0bin2c.exe" cull_cs.cso cull_cs cull_cs
 
 echo Done.
-pause
@@ -0,0 +1,9 @@
+// Overdraw debug view: every pixel the rasterizer covers adds one step with additive blending, whatever the
+// shape's coverage there, so the picture is the fill rate actually paid. Red saturates after 8 layers, green
+// after 24 and blue after 64: dark red -> red -> yellow -> white.
+static const float4 heat_step = float4(1.0f / 8.0f, 1.0f / 24.0f, 1.0f / 64.0f, 0.0f);
+
+float4 main(float4 sv_position : SV_POSITION) : SV_TARGET
+{
+    return heat_step;
+}
@@ -1,3 +1,20 @@
+// Permutations: the build (hlsl_to_c_files.bat, or fgui_add_shader in CMake) compiles this file once with
+// everything enabled (quad_ps) and once per family with only that family's FGUI_PS_* branches (quad_ps_<family>),
+// so a batch of one family doesn't pay for the registers and divergence of the others. Keep the families in sync
+// with fgui::family_of.
+#ifndef FGUI_PS_SHAPES
+#define FGUI_PS_SHAPES 1 // 0 box, 1 box outline, 4 line, 6 triangle
+#endif
+#ifndef FGUI_PS_CIRCLES
+#define FGUI_PS_CIRCLES 1 // 2 circle, 3 circle outline
+#endif
+#ifndef FGUI_PS_TEXT
+#define FGUI_PS_TEXT 1 // 5 glyph quad
+#endif
+#ifndef FGUI_PS_IMAGES
+#define FGUI_PS_IMAGES 1 // 8 image, 9 image with trilinear filtering
+#endif
+
 struct PS_INPUT
 {
     float4 sv_position : SV_POSITION; // clip-space pixel position from the vertex shader
@@ -15,6 +32,9 @@ struct PS_INPUT
 Texture2D font_tex : register(t0);
 SamplerState font_samp : register(s0);
 
+// Trilinear sampler for minified images (type 9), reads the mip chain built at load time
+SamplerState linear_samp : register(s1);
+
 // Signed Distance Function for an axis-aligned box
 // Top left corner at the origin and size defined by 'size'. 
 float sd_box(float2 p, float2 size)
@@ -77,6 +97,7 @@ float4 main(PS_INPUT input) : SV_TARGET
 	// Local pixel position within the shape instance, in pixels. 
     float2 local = input.quad_pos * input.inst_size;
 
+#if FGUI_PS_TEXT
     // Textured quad (glyph)
     if (input.inst_type == 5)
     {
@@ -95,7 +116,9 @@ float4 main(PS_INPUT input) : SV_TARGET
         // Premultiplied RGB per-subpixel
         out_rgb = input.inst_clr.rgb * coverage * input.inst_clr.a;
     }
-    else if (input.inst_type == 2)
+#endif
+#if FGUI_PS_CIRCLES
+    if (input.inst_type == 2)
     {
         // Filled circle
         float2 center = 0.5f * input.inst_size;
@@ -127,7 +150,9 @@ float4 main(PS_INPUT input) : SV_TARGET
         // premultiply RGB by resulting alpha
         out_rgb = input.inst_clr.rgb * out_a;
     }
-    else if (input.inst_type == 0)
+#endif
+#if FGUI_PS_SHAPES
+    if (input.inst_type == 0)
     {
         // Filled box
         float2 p = local;
@@ -178,17 +203,24 @@ float4 main(PS_INPUT input) : SV_TARGET
         out_a *= alpha;
         out_rgb = input.inst_clr.rgb * out_a;
     }
-    else if (input.inst_type == 8)
+#endif
+#if FGUI_PS_IMAGES
+    if (input.inst_type == 8 || input.inst_type == 9)
     {
         // Image quad  sample texture with standard alpha blending
         float2 uv = float2(lerp(input.inst_uv.x, input.inst_uv.z, input.quad_pos.x),
                            lerp(input.inst_uv.y, input.inst_uv.w, input.quad_pos.y));
-        float4 texel = font_tex.Sample(font_samp, uv);
-
-        // Apply tint color and alpha
-        out_rgb = texel.rgb * input.inst_clr.rgb * texel.a * input.inst_clr.a;
+        float4 texel;
+        if (input.inst_type == 9)
+            texel = font_tex.Sample(linear_samp, uv);
+        else
+            texel = font_tex.Sample(font_samp, uv);
+
+        // Images are premultiplied at load time, only the tint still needs its alpha applied
+        out_rgb = texel.rgb * input.inst_clr.rgb * input.inst_clr.a;
         out_a = texel.a * input.inst_clr.a;
     }
+#endif
 
     // Return premultiplied color
     return float4(out_rgb, out_a);
@@ -1,644 +0,0 @@
-#include "quad_ps.h"
-
-unsigned char g_quad_ps[7016] = {
-	0x44, 0x58, 0x42, 0x43, 0xc6, 0x87, 0x62, 0x04, 0x51, 0x60, 0xba, 
-	0xad, 0x63, 0x11, 0x63, 0xe8, 0x99, 0x0e, 0x2b, 0x59, 0x01, 0x00, 
-	0x00, 0x00, 0x68, 0x1b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c, 
-	0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 
-	0xd0, 0x01, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0xb8, 0x0b, 0x00, 
-	0x00, 0xd4, 0x0b, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-	0x53, 0x47, 0x31, 0x40, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
-	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x01, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x01, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x02, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 
-	0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 
-	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
-	0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x34, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x34, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0f, 0x0f, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0x5f, 0x50, 0x6f, 
-	0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x54, 0x45, 0x58, 0x43, 
-	0x4f, 0x4f, 0x52, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x53, 0x47, 
-	0x31, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x53, 0x56, 0x5f, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x00, 
-	0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0xec, 0x01, 0x00, 0x00, 0x34, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 
-	0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 
-	0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 
-	0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 
-	0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 
-	0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 
-	0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 
-	0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 
-	0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 
-	0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 
-	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x42, 0x00, 0x03, 
-	0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-	0x01, 0x01, 0x62, 0x00, 0x03, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 
-	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x42, 0x00, 0x03, 0x02, 
-	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
-	0x02, 0x61, 0x00, 0x03, 0x02, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
-	0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x71, 0x00, 0x03, 0x02, 0x00, 
-	0x00, 0x2e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x03, 
-	0x44, 0x00, 0x03, 0x02, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x06, 
-	0x00, 0x00, 0x00, 0x01, 0x04, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 
-	0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x05, 0x44, 
-	0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x00, 0x44, 0x10, 0x03, 0x00, 0x00, 0x00, 0x0f, 
-	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 
-	0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 
-	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-	0x04, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 
-	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x53, 0x54, 0x41, 0x54, 
-	0xec, 0x07, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x00, 
-	0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 
-	0x00, 0x00, 0xd4, 0x07, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 
-	0x0c, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 
-	0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 
-	0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 
-	0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 
-	0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 
-	0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 
-	0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 
-	0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 
-	0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 
-	0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 
-	0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 
-	0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 
-	0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 
-	0x00, 0x89, 0x20, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x32, 0x22, 
-	0x88, 0x09, 0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 
-	0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 
-	0x0b, 0x84, 0xc4, 0x4c, 0x10, 0x88, 0xc1, 0x08, 0x40, 0x09, 0x00, 
-	0x0a, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 
-	0x40, 0x10, 0x44, 0x41, 0x90, 0x51, 0x0c, 0x82, 0x20, 0x88, 0x82, 
-	0x20, 0xa4, 0x18, 0x00, 0x41, 0x10, 0xc5, 0x40, 0x4a, 0x19, 0x06, 
-	0x62, 0x20, 0xe6, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f, 
-	0x25, 0xa4, 0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x51, 0x31, 0x0c, 0xc3, 
-	0x40, 0x50, 0x71, 0xcf, 0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0x1f, 
-	0x02, 0xcd, 0xb0, 0x10, 0x28, 0x78, 0x0a, 0xe3, 0x10, 0x10, 0x34, 
-	0x0c, 0xc3, 0x40, 0x10, 0xc4, 0x40, 0x51, 0x21, 0x06, 0x62, 0x18, 
-	0x68, 0x2a, 0xc6, 0x40, 0x0c, 0xc3, 0x30, 0x50, 0x35, 0x47, 0x10, 
-	0x14, 0x03, 0x22, 0x0a, 0x82, 0xb8, 0x08, 0x1b, 0x08, 0x18, 0x46, 
-	0x20, 0x86, 0x99, 0xda, 0x60, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 
-	0x1e, 0xdc, 0x80, 0x16, 0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 
-	0xa1, 0x1c, 0xe4, 0x80, 0x14, 0xf8, 0xc0, 0x1e, 0xca, 0x61, 0x1c, 
-	0xe8, 0xe1, 0x1d, 0xe4, 0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde, 0x21, 
-	0x1c, 0xe8, 0x81, 0x0d, 0xc0, 0x80, 0x0e, 0xfc, 0x00, 0x0c, 0xfc, 
-	0x40, 0x0f, 0xf4, 0xa0, 0x1d, 0xd2, 0x01, 0x1e, 0xe6, 0xe1, 0x17, 
-	0xe8, 0x21, 0x1f, 0xe0, 0xa1, 0x1c, 0x50, 0x40, 0xcc, 0x24, 0x06, 
-	0xe3, 0xc0, 0x0e, 0xe1, 0x30, 0x0f, 0xf3, 0xe0, 0x06, 0xb4, 0x50, 
-	0x0e, 0xf8, 0x40, 0x0f, 0xf5, 0x20, 0x0f, 0xe5, 0x20, 0x07, 0xa4, 
-	0xc0, 0x07, 0xf6, 0x50, 0x0e, 0xe3, 0x40, 0x0f, 0xef, 0x20, 0x0f, 
-	0x7c, 0x60, 0x0e, 0xec, 0xf0, 0x0e, 0xe1, 0x40, 0x0f, 0x6c, 0x00, 
-	0x06, 0x74, 0xe0, 0x07, 0x60, 0xe0, 0x07, 0x48, 0xd8, 0x38, 0xea, 
-	0x6e, 0x92, 0xa6, 0x88, 0x12, 0x26, 0x9f, 0x05, 0x98, 0x67, 0x21, 
-	0x22, 0x76, 0x02, 0x26, 0x02, 0x05, 0x04, 0x7d, 0xa9, 0x41, 0x00, 
-	0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 
-	0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 
-	0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 
-	0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 
-	0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 
-	0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 
-	0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 
-	0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 
-	0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 
-	0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 
-	0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 
-	0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 
-	0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x08, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 
-	0x06, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x0c, 0x79, 0x10, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x18, 0xf2, 0x28, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x61, 0x80, 0x00, 0x08, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x13, 0x01, 0x01, 
-	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 
-	0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-	0x21, 0x4f, 0x05, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x43, 0x1e, 0x0c, 0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xb2, 0x40, 0x00, 0x00, 0x16, 0x00, 0x00, 
-	0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 
-	0x26, 0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0x60, 0x04, 0xa0, 0x18, 
-	0x8a, 0xa0, 0x24, 0xca, 0xa0, 0x10, 0x4a, 0xa1, 0x3c, 0xca, 0xa1, 
-	0x20, 0x8a, 0xa2, 0x70, 0x07, 0xca, 0x9b, 0xa0, 0x4c, 0xa8, 0x28, 
-	0x89, 0x32, 0x28, 0x84, 0x11, 0x80, 0x22, 0x28, 0x81, 0x52, 0x28, 
-	0x10, 0xf2, 0x66, 0x00, 0x08, 0x9c, 0x01, 0xa0, 0x70, 0x2c, 0x0d, 
-	0x23, 0x9e, 0x07, 0x00, 0x9e, 0xe7, 0x79, 0x9e, 0xe7, 0x79, 0x02, 
-	0x81, 0x78, 0x1e, 0x00, 0x00, 0x9e, 0xe7, 0x79, 0x00, 0x00, 0x00, 
-	0x00, 0x79, 0x18, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x1a, 0x03, 
-	0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x8f, 0x0c, 0x6f, 0xec, 0xed, 
-	0x4d, 0x0c, 0x24, 0xc6, 0x05, 0xc7, 0x45, 0xa6, 0x06, 0xa6, 0xc6, 
-	0x65, 0x46, 0x06, 0x04, 0x45, 0x2c, 0x06, 0xc6, 0x26, 0x2c, 0xc7, 
-	0x26, 0x86, 0x2c, 0x65, 0x43, 0x10, 0x4c, 0x10, 0x88, 0x64, 0x82, 
-	0x40, 0x28, 0x1b, 0x84, 0x81, 0xd8, 0x20, 0x10, 0x04, 0x05, 0xb8, 
-	0xb9, 0x09, 0x02, 0xb1, 0x6c, 0x18, 0x0e, 0x84, 0x98, 0x20, 0x78, 
-	0x60, 0x40, 0xc4, 0xec, 0xcd, 0x8d, 0xee, 0x8b, 0xae, 0x0c, 0x6f, 
-	0x82, 0x40, 0x30, 0x13, 0x04, 0xa2, 0xd9, 0x20, 0x10, 0xcd, 0x86, 
-	0x84, 0x50, 0x16, 0x82, 0x18, 0x18, 0xc2, 0xd9, 0x10, 0x3c, 0x13, 
-	0x04, 0x30, 0x08, 0x03, 0x26, 0x66, 0x6f, 0x6e, 0x74, 0x5f, 0x73, 
-	0x61, 0x6d, 0x70, 0x1b, 0x10, 0x22, 0x92, 0x08, 0x62, 0x20, 0x80, 
-	0x0d, 0xc1, 0xb4, 0x81, 0x80, 0x00, 0x80, 0x9a, 0x20, 0x08, 0xc0, 
-	0x06, 0x60, 0xc3, 0x40, 0x5c, 0xd7, 0x86, 0x00, 0xdb, 0x30, 0x0c, 
-	0x56, 0x36, 0x41, 0x08, 0x03, 0x31, 0xd8, 0x10, 0x6c, 0x24, 0xda, 
-	0xc2, 0xd2, 0xdc, 0xb8, 0x4c, 0x59, 0x7d, 0x41, 0xbd, 0xcd, 0xa5, 
-	0xd1, 0xa5, 0xbd, 0xb9, 0x4d, 0x10, 0x0a, 0x6c, 0x82, 0x50, 0x64, 
-	0x1b, 0x02, 0x62, 0x82, 0x50, 0x68, 0x13, 0x84, 0x62, 0x9b, 0x20, 
-	0x10, 0xce, 0x06, 0x81, 0x0c, 0xc8, 0x60, 0xc3, 0x42, 0x78, 0x1f, 
-	0x18, 0x84, 0x81, 0x18, 0x0c, 0x62, 0x40, 0x8c, 0x41, 0x19, 0x10, 
-	0xa1, 0x2a, 0xc2, 0x1a, 0x7a, 0x7a, 0x92, 0x22, 0x9a, 0x20, 0x14, 
-	0xdc, 0x86, 0x65, 0x38, 0x83, 0x6f, 0x0c, 0xc2, 0x00, 0x0d, 0x06, 
-	0x34, 0x18, 0xc6, 0xa0, 0x0c, 0x36, 0x04, 0xc3, 0x86, 0x85, 0x39, 
-	0x83, 0x6f, 0x0c, 0xd4, 0x00, 0x0d, 0x06, 0x34, 0x18, 0xd0, 0xa0, 
-	0x0c, 0x36, 0x04, 0xcc, 0x86, 0x85, 0x0c, 0xce, 0xe0, 0x1b, 0x03, 
-	0x36, 0x40, 0x83, 0x01, 0x0d, 0x98, 0x31, 0x28, 0x83, 0x09, 0x02, 
-	0xf1, 0x6c, 0x08, 0xc8, 0x60, 0x82, 0x50, 0x74, 0x1b, 0x04, 0x32, 
-	0x18, 0x36, 0x2c, 0x6e, 0x70, 0x06, 0xdf, 0x18, 0xbc, 0x01, 0x1a, 
-	0x0c, 0x70, 0xc0, 0xa0, 0x41, 0x1c, 0x4c, 0x10, 0x08, 0x68, 0x43, 
-	0xe0, 0x06, 0x1b, 0x96, 0x39, 0x38, 0x83, 0x6f, 0x0c, 0xe8, 0x00, 
-	0x0d, 0x06, 0x38, 0x60, 0xc0, 0x20, 0x0e, 0x36, 0x04, 0x73, 0x30, 
-	0x41, 0x20, 0xa2, 0x0d, 0x02, 0x19, 0xdc, 0xc1, 0x86, 0x05, 0x39, 
-	0x83, 0x6f, 0x0c, 0xec, 0x00, 0x0d, 0x06, 0x31, 0x20, 0x83, 0x31, 
-	0xc0, 0x83, 0x09, 0x02, 0x21, 0x4d, 0x10, 0x0a, 0x6f, 0x43, 0x80, 
-	0x6c, 0x58, 0xf4, 0xe0, 0x0c, 0xf6, 0x60, 0x0c, 0xf8, 0x00, 0x0e, 
-	0x06, 0x38, 0x70, 0x83, 0x31, 0x88, 0x83, 0x09, 0x02, 0x31, 0x6d, 
-	0x08, 0xf4, 0x60, 0xc3, 0xe2, 0x07, 0x67, 0xf0, 0x8d, 0xc1, 0x1f, 
-	0xa0, 0xc1, 0x20, 0x06, 0x73, 0x30, 0x06, 0x78, 0xb0, 0x21, 0x31, 
-	0x83, 0x34, 0x58, 0x83, 0x36, 0x90, 0x83, 0x3a, 0xc8, 0x83, 0x3e, 
-	0x00, 0x05, 0x26, 0x53, 0x56, 0x5f, 0x54, 0x61, 0x72, 0x67, 0x65, 
-	0x74, 0x13, 0x84, 0xe2, 0xdb, 0xb0, 0x10, 0xa2, 0xf0, 0x8d, 0x42, 
-	0x18, 0x8c, 0xc1, 0x20, 0x06, 0xc4, 0x18, 0xe0, 0xc1, 0x86, 0x80, 
-	0x14, 0x36, 0x0c, 0xa1, 0x50, 0x0a, 0xc0, 0x86, 0xc2, 0xea, 0x4c, 
-	0xa1, 0x02, 0x88, 0x88, 0xc9, 0x85, 0xb9, 0x8d, 0xa1, 0x95, 0xcd, 
-	0x4d, 0x10, 0x08, 0x8a, 0x86, 0x19, 0xdb, 0x5b, 0x18, 0xdd, 0xdc, 
-	0x04, 0x81, 0xa8, 0x58, 0xa4, 0xb9, 0xcd, 0xd1, 0xcd, 0x4d, 0x10, 
-	0x08, 0x8b, 0x44, 0x9a, 0x1b, 0xdd, 0x1c, 0x8d, 0xb9, 0xb4, 0xb3, 
-	0x2f, 0x36, 0xb2, 0x09, 0x02, 0x71, 0xd1, 0x98, 0x4b, 0x3b, 0xfb, 
-	0x9a, 0xa3, 0x23, 0x42, 0x57, 0x86, 0xf7, 0xe5, 0xf6, 0x26, 0xd7, 
-	0xb6, 0xc1, 0x41, 0x85, 0x54, 0x50, 0x85, 0x55, 0x60, 0x85, 0x56, 
-	0x70, 0x05, 0x3f, 0x78, 0x05, 0x58, 0x88, 0x05, 0x37, 0x90, 0x05, 
-	0xa6, 0x0a, 0x1b, 0x9b, 0x5d, 0x9b, 0x4b, 0x1a, 0x59, 0x99, 0x1b, 
-	0xdd, 0x94, 0x20, 0xa8, 0x42, 0x86, 0xe7, 0x62, 0x57, 0x26, 0x37, 
-	0x97, 0xf6, 0xe6, 0x36, 0x25, 0x20, 0x9a, 0x90, 0xe1, 0xb9, 0xd8, 
-	0x85, 0xb1, 0xd9, 0x95, 0xc9, 0x4d, 0x09, 0x8a, 0x3a, 0x64, 0x78, 
-	0x2e, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x4d, 0x6f, 0x64, 0x65, 
-	0x6c, 0x53, 0x02, 0xa4, 0x0c, 0x19, 0x9e, 0x8b, 0x5c, 0xd9, 0xdc, 
-	0x5b, 0x9d, 0xdc, 0x58, 0xd9, 0xdc, 0x94, 0x80, 0xaa, 0x44, 0x86, 
-	0xe7, 0x42, 0x97, 0x07, 0x57, 0x16, 0xe4, 0xe6, 0xf6, 0x46, 0x17, 
-	0x46, 0x97, 0xf6, 0xe6, 0x36, 0x37, 0x25, 0xc8, 0xea, 0x90, 0xe1, 
-	0xb9, 0xd8, 0xa5, 0x95, 0xdd, 0x25, 0x91, 0x4d, 0xd1, 0x85, 0xd1, 
-	0x95, 0x4d, 0x09, 0xb6, 0x3a, 0x64, 0x78, 0x2e, 0x65, 0x6e, 0x74, 
-	0x72, 0x79, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x53, 0x02, 0x53, 
-	0xe8, 0x42, 0x86, 0xe7, 0x32, 0xf6, 0x56, 0xe7, 0x46, 0x57, 0x26, 
-	0x37, 0x37, 0x25, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 
-	0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 
-	0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 
-	0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 
-	0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 
-	0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 
-	0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 
-	0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 
-	0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 
-	0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 
-	0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 
-	0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 
-	0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 
-	0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 
-	0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 
-	0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 
-	0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 
-	0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 
-	0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 
-	0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 
-	0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 
-	0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 
-	0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 
-	0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 
-	0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 
-	0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 
-	0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 
-	0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 
-	0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x30, 
-	0x83, 0x81, 0xc8, 0x01, 0x1f, 0xdc, 0x40, 0x1c, 0xe4, 0xa1, 0x1c, 
-	0xc2, 0x61, 0x1d, 0xdc, 0x40, 0x1c, 0xe4, 0x01, 0x00, 0x00, 0x00, 
-	0x71, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x66, 0x00, 0x0d, 
-	0x97, 0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 
-	0x1b, 0x82, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x44, 0x00, 0x13, 
-	0x11, 0x02, 0xcd, 0xb0, 0x10, 0x76, 0xe0, 0x0c, 0x97, 0xef, 0x3c, 
-	0xfe, 0xe0, 0x4c, 0xb6, 0x5f, 0xdc, 0xb6, 0x05, 0x4c, 0xc3, 0xe5, 
-	0x3b, 0x8f, 0xbf, 0x38, 0xc0, 0x20, 0x36, 0x0f, 0x35, 0xf9, 0xc5, 
-	0x6d, 0x9b, 0xc0, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x8b, 0x03, 0x0c, 
-	0x62, 0xf3, 0x50, 0x93, 0x8f, 0xdc, 0xb6, 0x15, 0x40, 0xc3, 0xe5, 
-	0x3b, 0x8f, 0x2f, 0x01, 0xcc, 0xb3, 0x10, 0x7e, 0x71, 0xdb, 0x36, 
-	0x50, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x34, 0x39, 0x11, 0x81, 0x52, 
-	0xd3, 0x43, 0x4d, 0x7e, 0x71, 0xdb, 0x46, 0xf0, 0x0c, 0x97, 0xef, 
-	0x3c, 0x3e, 0xd5, 0x00, 0x11, 0xe6, 0x17, 0xb7, 0x6d, 0x00, 0x04, 
-	0x03, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 
-	0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xd1, 
-	0x84, 0x25, 0xc8, 0x51, 0xac, 0x8d, 0xf0, 0xd5, 0x0b, 0xcc, 0xd2, 
-	0xa4, 0xbb, 0x59, 0x44, 0x58, 0x49, 0x4c, 0x8c, 0x0f, 0x00, 0x00, 
-	0x60, 0x00, 0x00, 0x00, 0xe3, 0x03, 0x00, 0x00, 0x44, 0x58, 0x49, 
-	0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x74, 0x0f, 
-	0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xda, 
-	0x03, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 
-	0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 
-	0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 
-	0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 
-	0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 
-	0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 
-	0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 
-	0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 
-	0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-	0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 
-	0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 
-	0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 
-	0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 
-	0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 
-	0x00, 0x4c, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 
-	0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 
-	0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 
-	0x10, 0x8c, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 
-	0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 0x40, 0x10, 0x44, 0x41, 
-	0x90, 0x51, 0x0c, 0x82, 0x20, 0x88, 0x82, 0x20, 0xa4, 0x18, 0x00, 
-	0x41, 0x10, 0xc5, 0x40, 0x4a, 0x19, 0x06, 0x62, 0x20, 0xe6, 0xa6, 
-	0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f, 0x25, 0xa4, 0x95, 0x98, 
-	0xfc, 0xe2, 0xb6, 0x51, 0x31, 0x0c, 0xc3, 0x40, 0x50, 0x71, 0xcf, 
-	0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0x1f, 0x02, 0xcd, 0xb0, 0x10, 
-	0x28, 0x78, 0x0a, 0xe3, 0x10, 0x10, 0x34, 0x0c, 0xc3, 0x40, 0x10, 
-	0xc4, 0x40, 0x51, 0x21, 0x06, 0x62, 0x18, 0x68, 0x2a, 0xc6, 0x40, 
-	0x0c, 0xc3, 0x30, 0x50, 0x35, 0x47, 0x10, 0x14, 0x03, 0x22, 0x0a, 
-	0x82, 0xb8, 0x08, 0x1b, 0x08, 0x18, 0x46, 0x20, 0x86, 0x99, 0xda, 
-	0x60, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x80, 0x16, 
-	0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xe4, 0x80, 
-	0x14, 0xf8, 0xc0, 0x1e, 0xca, 0x61, 0x1c, 0xe8, 0xe1, 0x1d, 0xe4, 
-	0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde, 0x21, 0x1c, 0xe8, 0x81, 0x0d, 
-	0xc0, 0x80, 0x0e, 0xfc, 0x00, 0x0c, 0xfc, 0x40, 0x0f, 0xf4, 0xa0, 
-	0x1d, 0xd2, 0x01, 0x1e, 0xe6, 0xe1, 0x17, 0xe8, 0x21, 0x1f, 0xe0, 
-	0xa1, 0x1c, 0x50, 0x40, 0xcc, 0x24, 0x06, 0xe3, 0xc0, 0x0e, 0xe1, 
-	0x30, 0x0f, 0xf3, 0xe0, 0x06, 0xb4, 0x50, 0x0e, 0xf8, 0x40, 0x0f, 
-	0xf5, 0x20, 0x0f, 0xe5, 0x20, 0x07, 0xa4, 0xc0, 0x07, 0xf6, 0x50, 
-	0x0e, 0xe3, 0x40, 0x0f, 0xef, 0x20, 0x0f, 0x7c, 0x60, 0x0e, 0xec, 
-	0xf0, 0x0e, 0xe1, 0x40, 0x0f, 0x6c, 0x00, 0x06, 0x74, 0xe0, 0x07, 
-	0x60, 0xe0, 0x07, 0x48, 0xd8, 0x38, 0xea, 0x6e, 0x92, 0xa6, 0x88, 
-	0x12, 0x26, 0x9f, 0x05, 0x98, 0x67, 0x21, 0x22, 0x76, 0x02, 0x26, 
-	0x02, 0x05, 0x04, 0x7d, 0xa9, 0x41, 0x4c, 0x01, 0x00, 0x00, 0x00, 
-	0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 
-	0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 
-	0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 
-	0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 
-	0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 
-	0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 
-	0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 
-	0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 
-	0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 
-	0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 
-	0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 
-	0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 
-	0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 
-	0x06, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x0c, 0x79, 0x10, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x18, 0xf2, 0x28, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x61, 0x80, 0x00, 0x08, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x13, 0x01, 0x01, 
-	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 
-	0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-	0x21, 0x4f, 0x05, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x43, 0x1e, 0x0c, 0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xb2, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 
-	0x00, 0x32, 0x1e, 0x98, 0x14, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 
-	0x26, 0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0x60, 0x04, 0xa0, 0x24, 
-	0x8a, 0xa1, 0x08, 0xca, 0xa0, 0x10, 0x4a, 0xa1, 0x3c, 0xca, 0xa1, 
-	0x20, 0xa8, 0x28, 0x89, 0x32, 0x28, 0x84, 0x11, 0x80, 0x22, 0x28, 
-	0x81, 0x52, 0x28, 0x10, 0xf2, 0x66, 0x00, 0x08, 0x9c, 0x01, 0xa0, 
-	0x70, 0x2c, 0x0d, 0x23, 0x9e, 0x07, 0x00, 0x9e, 0xe7, 0x79, 0x9e, 
-	0xe7, 0x79, 0x02, 0x81, 0x78, 0x1e, 0x00, 0x00, 0x9e, 0xe7, 0x79, 
-	0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x82, 0x00, 0x00, 
-	0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x8f, 0x0c, 
-	0x6f, 0xec, 0xed, 0x4d, 0x0c, 0x24, 0xc6, 0x05, 0xc7, 0x45, 0xa6, 
-	0x06, 0xa6, 0xc6, 0x65, 0x46, 0x06, 0x04, 0x45, 0x2c, 0x06, 0xc6, 
-	0x26, 0x2c, 0xc7, 0x26, 0x86, 0x2c, 0x65, 0x43, 0x10, 0x4c, 0x10, 
-	0x88, 0x64, 0x82, 0x40, 0x28, 0x1b, 0x84, 0x81, 0x98, 0x20, 0x10, 
-	0xcb, 0x06, 0x61, 0x30, 0x28, 0xc0, 0xcd, 0x4d, 0x10, 0x08, 0x66, 
-	0xc3, 0x80, 0x24, 0xc4, 0x04, 0xc1, 0xe3, 0x08, 0x4c, 0x10, 0x88, 
-	0x66, 0x83, 0x40, 0x18, 0x1b, 0x12, 0x62, 0x61, 0x08, 0x62, 0x68, 
-	0x08, 0x67, 0x43, 0xf0, 0x4c, 0x10, 0xc0, 0xa0, 0xdb, 0x80, 0x10, 
-	0x11, 0x43, 0x10, 0x03, 0x01, 0x6c, 0x08, 0xa4, 0x0d, 0x04, 0x04, 
-	0x00, 0xd3, 0x04, 0x21, 0x0c, 0xbc, 0x0d, 0x41, 0x35, 0x41, 0x10, 
-	0x00, 0x12, 0x6d, 0x61, 0x69, 0x6e, 0x5c, 0xa6, 0xac, 0xbe, 0xa0, 
-	0xde, 0xe6, 0xd2, 0xe8, 0xd2, 0xde, 0xdc, 0x26, 0x08, 0x05, 0x35, 
-	0x41, 0x28, 0xaa, 0x0d, 0x01, 0x31, 0x41, 0x28, 0xac, 0x09, 0x42, 
-	0x71, 0x4d, 0x10, 0x08, 0x67, 0x83, 0xf0, 0x7d, 0x1b, 0x16, 0x22, 
-	0xd3, 0x36, 0xae, 0x1b, 0x3a, 0xc2, 0x03, 0x03, 0x22, 0x54, 0x45, 
-	0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x13, 0x84, 0x02, 0xdb, 0xb0, 
-	0x0c, 0x62, 0xa0, 0x79, 0xdc, 0x18, 0x0c, 0x63, 0x30, 0x78, 0x60, 
-	0xb0, 0x21, 0x18, 0x36, 0x2c, 0x8d, 0x18, 0x68, 0x5e, 0x19, 0x8c, 
-	0xc1, 0x30, 0x06, 0xc3, 0x18, 0x80, 0xc1, 0x86, 0xa0, 0xd9, 0xb0, 
-	0x7c, 0x62, 0xa0, 0x79, 0x67, 0x30, 0x06, 0xc3, 0x18, 0x34, 0x1e, 
-	0x18, 0x4c, 0x10, 0x88, 0x67, 0x43, 0xf0, 0x4d, 0x10, 0x8a, 0x6c, 
-	0x83, 0xf0, 0x0d, 0x1b, 0x96, 0x34, 0x10, 0x03, 0xcd, 0x53, 0x83, 
-	0x31, 0x18, 0xd6, 0xa0, 0x19, 0x03, 0x36, 0x98, 0x20, 0x10, 0xd0, 
-	0x86, 0x20, 0x0d, 0x36, 0x2c, 0x6e, 0x20, 0x06, 0x9a, 0xf7, 0x06, 
-	0x63, 0x30, 0xac, 0x41, 0xb3, 0xb1, 0xc1, 0x86, 0xc0, 0x0d, 0x26, 
-	0x08, 0x44, 0xb4, 0x41, 0xf8, 0xe4, 0x60, 0xc3, 0x92, 0x88, 0x81, 
-	0xe6, 0xc5, 0xc1, 0x18, 0x0c, 0xdd, 0xe7, 0xcd, 0xc1, 0x04, 0x81, 
-	0x90, 0x26, 0x08, 0x85, 0xb6, 0x21, 0x48, 0x36, 0x2c, 0x75, 0x20, 
-	0x06, 0x76, 0xe0, 0xdd, 0xc1, 0x1a, 0x0c, 0x6b, 0x90, 0x06, 0x1e, 
-	0x1b, 0x4c, 0x10, 0x88, 0x69, 0x43, 0x50, 0x07, 0x1b, 0x96, 0x3c, 
-	0x10, 0x03, 0xcd, 0xd3, 0x83, 0x31, 0x18, 0x3a, 0x37, 0xf0, 0xe6, 
-	0x60, 0x43, 0x12, 0x06, 0x64, 0x60, 0x06, 0x68, 0xd0, 0x06, 0x70, 
-	0x40, 0x07, 0x78, 0xb0, 0x07, 0x4c, 0xa6, 0xac, 0xbe, 0xa8, 0xc2, 
-	0xe4, 0xce, 0xca, 0xe8, 0x26, 0x08, 0xc5, 0xb6, 0x61, 0x21, 0xfa, 
-	0x40, 0xf3, 0x03, 0xce, 0x1b, 0x3a, 0xc2, 0x9b, 0x83, 0x0d, 0xc1, 
-	0x1f, 0x6c, 0x18, 0xf8, 0x00, 0x14, 0x80, 0x0d, 0xc5, 0x85, 0x85, 
-	0x02, 0x05, 0x54, 0x61, 0x63, 0xb3, 0x6b, 0x73, 0x49, 0x23, 0x2b, 
-	0x73, 0xa3, 0x9b, 0x12, 0x04, 0x55, 0xc8, 0xf0, 0x5c, 0xec, 0xca, 
-	0xe4, 0xe6, 0xd2, 0xde, 0xdc, 0xa6, 0x04, 0x44, 0x13, 0x32, 0x3c, 
-	0x17, 0xbb, 0x30, 0x36, 0xbb, 0x32, 0xb9, 0x29, 0x81, 0x51, 0x87, 
-	0x0c, 0xcf, 0x65, 0x0e, 0x2d, 0x8c, 0xac, 0x4c, 0xae, 0xe9, 0x8d, 
-	0xac, 0x8c, 0x6d, 0x4a, 0x90, 0x94, 0x21, 0xc3, 0x73, 0x91, 0x2b, 
-	0x9b, 0x7b, 0xab, 0x93, 0x1b, 0x2b, 0x9b, 0x9b, 0x12, 0x4c, 0x75, 
-	0xc8, 0xf0, 0x5c, 0xec, 0xd2, 0xca, 0xee, 0x92, 0xc8, 0xa6, 0xe8, 
-	0xc2, 0xe8, 0xca, 0xa6, 0x04, 0x55, 0x1d, 0x32, 0x3c, 0x97, 0x32, 
-	0x37, 0x3a, 0xb9, 0x3c, 0xa8, 0xb7, 0x34, 0x37, 0xba, 0xb9, 0x29, 
-	0x41, 0x28, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x51, 0x00, 0x00, 
-	0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 
-	0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 
-	0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 
-	0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 
-	0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 
-	0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 
-	0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 
-	0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 
-	0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 
-	0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 
-	0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 
-	0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 
-	0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 
-	0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 
-	0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 
-	0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 
-	0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 
-	0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 
-	0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 
-	0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 
-	0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 
-	0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 
-	0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 
-	0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 
-	0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 
-	0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 
-	0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 
-	0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x30, 0x83, 0x81, 0xc8, 0x01, 0x1f, 
-	0xdc, 0x40, 0x1c, 0xe4, 0xa1, 0x1c, 0xc2, 0x61, 0x1d, 0xdc, 0x40, 
-	0x1c, 0xe4, 0x01, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x20, 
-	0x00, 0x00, 0x00, 0x66, 0x00, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x80, 
-	0x34, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x1b, 0x82, 0x34, 0x5c, 0xbe, 
-	0xf3, 0xf8, 0x42, 0x44, 0x00, 0x13, 0x11, 0x02, 0xcd, 0xb0, 0x10, 
-	0x76, 0xe0, 0x0c, 0x97, 0xef, 0x3c, 0xfe, 0xe0, 0x4c, 0xb6, 0x5f, 
-	0xdc, 0xb6, 0x05, 0x4c, 0xc3, 0xe5, 0x3b, 0x8f, 0xbf, 0x38, 0xc0, 
-	0x20, 0x36, 0x0f, 0x35, 0xf9, 0xc5, 0x6d, 0x9b, 0xc0, 0x34, 0x5c, 
-	0xbe, 0xf3, 0xf8, 0x8b, 0x03, 0x0c, 0x62, 0xf3, 0x50, 0x93, 0x8f, 
-	0xdc, 0xb6, 0x15, 0x40, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x01, 0xcc, 
-	0xb3, 0x10, 0x7e, 0x71, 0xdb, 0x36, 0x50, 0x0d, 0x97, 0xef, 0x3c, 
-	0xbe, 0x34, 0x39, 0x11, 0x81, 0x52, 0xd3, 0x43, 0x4d, 0x7e, 0x71, 
-	0xdb, 0x46, 0xf0, 0x0c, 0x97, 0xef, 0x3c, 0x3e, 0xd5, 0x00, 0x11, 
-	0xe6, 0x17, 0xb7, 0x6d, 0x00, 0x04, 0x03, 0x20, 0x0d, 0x00, 0x61, 
-	0x20, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x13, 0x04, 0x55, 0x2c, 
-	0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x74, 0x8d, 0x00, 
-	0x10, 0x51, 0x78, 0x25, 0x57, 0x46, 0x05, 0x53, 0x48, 0x85, 0x1a, 
-	0x50, 0xa6, 0x01, 0xc5, 0x36, 0x03, 0x40, 0xc3, 0x18, 0xc1, 0x5a, 
-	0xab, 0xb5, 0xfa, 0x8d, 0x11, 0x80, 0x20, 0x08, 0xe2, 0xbf, 0x30, 
-	0x46, 0x00, 0x82, 0x20, 0x88, 0x7f, 0x63, 0x04, 0x20, 0x08, 0x82, 
-	0x20, 0x28, 0x8c, 0x00, 0x8c, 0x11, 0x80, 0x20, 0x08, 0xc2, 0xbf, 
-	0x30, 0x46, 0x00, 0x82, 0x20, 0x08, 0x7f, 0x33, 0x00, 0x63, 0x04, 
-	0x20, 0x08, 0x82, 0x24, 0x18, 0x8c, 0x11, 0x80, 0x20, 0x08, 0x82, 
-	0x60, 0x00, 0x00, 0x00, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x80, 
-	0xad, 0x81, 0xc4, 0xa5, 0x41, 0x1a, 0x50, 0x23, 0x06, 0x09, 0x00, 
-	0x82, 0x60, 0x80, 0xb1, 0xc1, 0xf4, 0xa9, 0x81, 0x1a, 0x54, 0x23, 
-	0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xd0, 0x81, 0x19, 0x88, 0xc1, 
-	0x1a, 0x78, 0xcd, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0x75, 
-	0x70, 0x06, 0x63, 0xc0, 0x06, 0x9d, 0x33, 0x62, 0x90, 0x00, 0x20, 
-	0x08, 0x06, 0x86, 0x1d, 0xa0, 0x01, 0x19, 0xb4, 0xc1, 0xf7, 0x8c, 
-	0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x71, 0x07, 0x69, 0x50, 0x06, 
-	0x6e, 0x30, 0x06, 0xd0, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x20, 
-	0x77, 0xa0, 0x06, 0x67, 0xf0, 0x06, 0x62, 0x10, 0x8d, 0x18, 0x24, 
-	0x00, 0x08, 0x82, 0x81, 0x91, 0x07, 0x6b, 0xe0, 0x06, 0x70, 0x30, 
-	0x06, 0xd2, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0x7a, 0xc0, 
-	0x06, 0x6f, 0x10, 0x07, 0x62, 0x30, 0x8d, 0x18, 0x24, 0x00, 0x08, 
-	0x82, 0x81, 0xb1, 0x07, 0x6d, 0x00, 0x07, 0x72, 0x40, 0x06, 0xd4, 
-	0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0x7c, 0xe0, 0x06, 0x71, 
-	0x30, 0x07, 0x68, 0x50, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 
-	0xd1, 0x07, 0x6f, 0xe0, 0x06, 0x74, 0x70, 0x06, 0xd6, 0x88, 0x41, 
-	0x02, 0x80, 0x20, 0x18, 0x18, 0x7e, 0x00, 0x07, 0x70, 0x50, 0x07, 
-	0x68, 0x70, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xf1, 0x07, 
-	0x71, 0x20, 0x07, 0x76, 0x90, 0x06, 0xd8, 0x88, 0x41, 0x02, 0x80, 
-	0x20, 0x18, 0x18, 0xa0, 0x20, 0x07, 0x73, 0x70, 0x07, 0x68, 0x90, 
-	0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x11, 0x0a, 0x73, 0x50, 
-	0x07, 0x78, 0xb0, 0x06, 0xda, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 
-	0x18, 0xa2, 0x40, 0x07, 0x76, 0x90, 0x07, 0x6a, 0xb0, 0x8d, 0x18, 
-	0x24, 0x00, 0x08, 0x82, 0x81, 0x31, 0x0a, 0x75, 0xb0, 0x07, 0x7a, 
-	0xd0, 0x06, 0xdc, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xa4, 
-	0x60, 0x07, 0x7c, 0xb0, 0x07, 0x6c, 0xd0, 0x8d, 0x18, 0x24, 0x00, 
-	0x08, 0x82, 0x81, 0x51, 0x0a, 0x77, 0xc0, 0x07, 0x7c, 0xf0, 0x06, 
-	0xde, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xa6, 0x80, 0x07, 
-	0x7d, 0xd0, 0x07, 0x6e, 0xf0, 0x19, 0x81, 0xc8, 0xc7, 0x08, 0x44, 
-	0x3e, 0xc3, 0x0d, 0x91, 0x1e, 0x80, 0xc1, 0x2c, 0x43, 0x20, 0x04, 
-	0x46, 0x59, 0xf1, 0xb1, 0x00, 0x91, 0x8f, 0x05, 0x18, 0x7c, 0xcc, 
-	0xc2, 0xe2, 0x63, 0x81, 0x22, 0x1f, 0x0b, 0x34, 0xf8, 0x8c, 0x18, 
-	0x3c, 0x00, 0x08, 0x82, 0x41, 0xc4, 0x0a, 0x71, 0xe0, 0x75, 0x44, 
-	0x10, 0x06, 0x61, 0x70, 0x0a, 0xa7, 0x90, 0x06, 0x61, 0x30, 0x9a, 
-	0x10, 0x00, 0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0x23, 0x06, 
-	0x06, 0x00, 0x82, 0x60, 0xc0, 0xc4, 0xc2, 0x28, 0x0c, 0x23, 0x06, 
-	0x06, 0x00, 0x82, 0x60, 0xc0, 0xc8, 0x02, 0x29, 0x0c, 0x23, 0x06, 
-	0x06, 0x00, 0x82, 0x60, 0xc0, 0xcc, 0x42, 0x29, 0x0c, 0x26, 0x0c, 
-	0xf0, 0xb1, 0x40, 0x80, 0x8f, 0x75, 0x71, 0x20, 0x1f, 0x0b, 0x04, 
-	0xf9, 0xd8, 0x27, 0x06, 0xf2, 0xb1, 0x00, 0x91, 0x8f, 0x85, 0xc1, 
-	0x18, 0xc8, 0xc7, 0x82, 0x44, 0x3e, 0x36, 0x06, 0x64, 0x20, 0x1f, 
-	0x0b, 0x14, 0xf9, 0xcc, 0x12, 0x50, 0xc3, 0x0d, 0x69, 0x50, 0x0b, 
-	0x60, 0x30, 0xcb, 0x30, 0x10, 0x81, 0x8d, 0x01, 0x1d, 0xc8, 0xc7, 
-	0xc0, 0xc0, 0x0e, 0xe0, 0x63, 0x41, 0x19, 0xc8, 0xc7, 0xc2, 0x00, 
-	0x0f, 0xe0, 0x63, 0x81, 0x19, 0xc8, 0xc7, 0x86, 0x41, 0x3e, 0x26, 
-	0x08, 0xf2, 0xb1, 0x40, 0x80, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 
-	0x18, 0x30, 0xe7, 0x80, 0x0a, 0x81, 0x05, 0x49, 0x7c, 0x2c, 0x14, 
-	0x82, 0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0xa3, 0x0e, 
-	0xa8, 0x20, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0xb3, 0x0e, 
-	0xe3, 0x10, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0xc3, 0x0e, 
-	0xab, 0x40, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0xd3, 0x0e, 
-	0xe5, 0x10, 0x58, 0x30, 0xc0, 0xc7, 0x8c, 0x80, 0x3e, 0x23, 0x06, 
-	0x06, 0x00, 0x82, 0x60, 0xc0, 0xc0, 0x83, 0x38, 0x04, 0x16, 0x8c, 
-	0x82, 0x7c, 0xac, 0x14, 0x82, 0xf8, 0xd8, 0x30, 0xc8, 0xc7, 0x82, 
-	0x3d, 0x90, 0x8f, 0x05, 0x83, 0x7c, 0x2c, 0x00, 0x05, 0xf9, 0x98, 
-	0x00, 0x0a, 0xf2, 0xb1, 0x01, 0x14, 0xe4, 0x33, 0x4b, 0x40, 0x0d, 
-	0x37, 0x90, 0xc2, 0x3b, 0x80, 0xc1, 0x2c, 0x43, 0x61, 0x04, 0xe6, 
-	0x07, 0xaf, 0x20, 0x1f, 0xdb, 0x83, 0x58, 0x80, 0x8f, 0x05, 0xa0, 
-	0x20, 0x1f, 0xe3, 0x83, 0x59, 0x80, 0x8f, 0x05, 0xa1, 0x20, 0x1f, 
-	0x1b, 0x06, 0xf9, 0x98, 0x20, 0xc8, 0xc7, 0x02, 0x01, 0x3e, 0x23, 
-	0x06, 0x06, 0x00, 0x82, 0x60, 0xc0, 0x88, 0xc4, 0x38, 0x04, 0x16, 
-	0x24, 0xf1, 0x31, 0x55, 0x50, 0xe2, 0x63, 0xc1, 0x00, 0x9f, 0x11, 
-	0x03, 0x03, 0x00, 0x41, 0x30, 0x60, 0x4c, 0x82, 0x1c, 0x86, 0x11, 
-	0x03, 0x03, 0x00, 0x41, 0x30, 0x60, 0x4e, 0xe2, 0x1f, 0x82, 0x11, 
-	0x03, 0x03, 0x00, 0x41, 0x30, 0x60, 0x50, 0xe2, 0x1c, 0x8a, 0x11, 
-	0x03, 0x03, 0x00, 0x41, 0x30, 0x60, 0x52, 0x22, 0x24, 0x02, 0x0b, 
-	0x06, 0xf8, 0xd8, 0x38, 0x20, 0xf1, 0xb1, 0x40, 0xa0, 0xcf, 0x88, 
-	0x81, 0x01, 0x80, 0x20, 0x18, 0x30, 0x2d, 0xf1, 0x0f, 0x81, 0x05, 
-	0xe0, 0x20, 0x1f, 0x13, 0x87, 0x20, 0x3e, 0x36, 0x0c, 0xf2, 0xb1, 
-	0x40, 0x90, 0x8f, 0xa9, 0x43, 0x13, 0x1f, 0x0b, 0x12, 0xfa, 0x8c, 
-	0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0x43, 0x13, 0x26, 0x11, 0x58, 
-	0x70, 0x0e, 0xf2, 0xb1, 0x74, 0x08, 0xe2, 0x63, 0xc3, 0x20, 0x1f, 
-	0x0b, 0x04, 0xf9, 0x18, 0x12, 0xc4, 0xc7, 0x82, 0x70, 0x90, 0x8f, 
-	0x05, 0xe5, 0x20, 0x1f, 0x13, 0xca, 0x41, 0x3e, 0x36, 0x94, 0x83, 
-	0x7c, 0x66, 0x09, 0xa8, 0xe1, 0x86, 0x74, 0xc0, 0x09, 0x30, 0x98, 
-	0x65, 0x38, 0x90, 0xc0, 0xc6, 0x61, 0x17, 0xe2, 0x63, 0xe3, 0xb0, 
-	0x0b, 0xf1, 0x19, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0xe9, 0x27, 
-	0x42, 0xa2, 0x17, 0x84, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0x98, 
-	0xc0, 0x42, 0x24, 0x7a, 0x41, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 
-	0x83, 0x29, 0x2c, 0x46, 0x42, 0x08, 0x46, 0x0c, 0x0c, 0x00, 0x04, 
-	0xc1, 0x80, 0x21, 0x0b, 0x91, 0x08, 0x46, 0x0c, 0x0c, 0x00, 0x04, 
-	0xc1, 0x80, 0x29, 0x8b, 0x9e, 0x08, 0x46, 0x0c, 0x0c, 0x00, 0x04, 
-	0xc1, 0x80, 0x31, 0x8b, 0x92, 0x18, 0x46, 0x0c, 0x0c, 0x00, 0x04, 
-	0xc1, 0x80, 0x39, 0x8b, 0x9f, 0x08, 0x2c, 0x18, 0xe0, 0x63, 0x46, 
-	0x40, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 0x60, 0xd4, 0x82, 
-	0x27, 0x02, 0x0b, 0xfa, 0x41, 0x3e, 0xf6, 0x0f, 0x41, 0x7c, 0x6c, 
-	0x18, 0xe4, 0x63, 0x41, 0x3d, 0xc8, 0xc7, 0x82, 0x41, 0x3e, 0x16, 
-	0xe8, 0x83, 0x7c, 0x4c, 0xd0, 0x07, 0xf9, 0xd8, 0xa0, 0x0f, 0xf2, 
-	0x99, 0x25, 0xa0, 0x86, 0x1b, 0xfc, 0xc1, 0x2d, 0xc0, 0x60, 0x96, 
-	0x21, 0x51, 0x02, 0xc3, 0x87, 0x94, 0x90, 0x8f, 0xe1, 0x83, 0x4a, 
-	0xc8, 0xc7, 0xec, 0x81, 0x25, 0xe0, 0x63, 0xc1, 0x3e, 0xc8, 0xc7, 
-	0xee, 0xc1, 0x25, 0xe0, 0x63, 0x01, 0x3f, 0xc8, 0x67, 0xc4, 0xc0, 
-	0x00, 0x40, 0x10, 0x0c, 0x18, 0xbd, 0x90, 0x8b, 0x61, 0xc4, 0xc0, 
-	0x00, 0x40, 0x10, 0x0c, 0x98, 0xbd, 0x98, 0x0b, 0xc1, 0x04, 0x24, 
-	0x3e, 0x26, 0x20, 0xf1, 0x19, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 
-	0x89, 0x2f, 0xc0, 0x42, 0xa8, 0x89, 0x11, 0x83, 0x03, 0x00, 0x41, 
-	0x30, 0x98, 0xfa, 0x22, 0x2c, 0x04, 0x9b, 0x30, 0x41, 0x90, 0x8f, 
-	0x09, 0x82, 0x7c, 0x2c, 0x10, 0xe0, 0x33, 0x62, 0x60, 0x00, 0x20, 
-	0x08, 0x06, 0xcc, 0x68, 0x90, 0x45, 0x30, 0x62, 0x70, 0x00, 0x20, 
-	0x08, 0x06, 0x93, 0x68, 0x98, 0x05, 0x72, 0x8c, 0x18, 0x1c, 0x00, 
-	0x08, 0x82, 0xc1, 0x34, 0x1a, 0x65, 0x11, 0xf0, 0x84, 0x05, 0x03, 
-	0x7c, 0xac, 0x25, 0x78, 0x42, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82, 
-	0x60, 0xc0, 0xa0, 0x06, 0x68, 0x08, 0x23, 0x06, 0x06, 0x00, 0x82, 
-	0x60, 0xc0, 0xa4, 0xc6, 0x59, 0x0c, 0x23, 0x06, 0x06, 0x00, 0x82, 
-	0x60, 0xc0, 0xa8, 0x86, 0x68, 0x04, 0x23, 0x06, 0x06, 0x00, 0x82, 
-	0x60, 0xc0, 0xac, 0x86, 0x5a, 0x14, 0x23, 0x06, 0x06, 0x00, 0x82, 
-	0x60, 0xc0, 0xb0, 0x06, 0x69, 0x04, 0x16, 0x0c, 0xf0, 0x31, 0xe3, 
-	0x88, 0x8f, 0x05, 0x02, 0x7d, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 
-	0x80, 0x81, 0x0d, 0xd1, 0x08, 0x2c, 0x18, 0x0b, 0xf9, 0x58, 0x59, 
-	0x04, 0xf1, 0xb1, 0x61, 0x90, 0x8f, 0x05, 0x82, 0x7c, 0xcc, 0x2d, 
-	0x82, 0xf8, 0x58, 0xd0, 0x13, 0xf2, 0xb1, 0x20, 0x2c, 0xe4, 0x63, 
-	0x42, 0x58, 0xc8, 0xc7, 0x86, 0xb0, 0x90, 0xcf, 0x2c, 0x01, 0x35, 
-	0xdc, 0x50, 0x16, 0xaf, 0x01, 0x06, 0xb3, 0x0c, 0x8b, 0x13, 0x58, 
-	0x4e, 0xf4, 0x44, 0x7c, 0x2c, 0x27, 0x7a, 0x22, 0x3e, 0x16, 0x16, 
-	0x3f, 0x11, 0x1f, 0x0b, 0x8b, 0x9f, 0x88, 0xcf, 0x88, 0x41, 0x02, 
-	0x80, 0x20, 0x18, 0x54, 0xbc, 0xc1, 0x17, 0x42, 0x20, 0x04, 0xc3, 
-	0x11, 0xc1, 0x5d, 0x08, 0xdf, 0x2c, 0x03, 0xd3, 0x04, 0x23, 0x06, 
-	0x09, 0x00, 0x82, 0x60, 0x50, 0xf9, 0x86, 0x5f, 0x18, 0x05, 0x31, 
-	0x58, 0x30, 0xd0, 0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x98, 
-	0xf1, 0xa8, 0x8d, 0x60, 0x96, 0xa0, 0x19, 0xa8, 0x18, 0x04, 0xc6, 
-	0x5e, 0x16, 0x0b, 0x10, 0xf9, 0x98, 0x80, 0xc8, 0xc7, 0x18, 0x21, 
-	0x3e, 0xc6, 0x08, 0xf1, 0x31, 0x41, 0x90, 0x8f, 0x09, 0x82, 0x7c, 
-	0x4c, 0x08, 0xe0, 0x33, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x0c, 
-	0x7b, 0xb4, 0x46, 0x60, 0x73, 0x21, 0x1a, 0xf2, 0x31, 0x21, 0x88, 
-	0x8f, 0x9d, 0x46, 0x10, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 
-	0x60, 0xe0, 0xc3, 0x35, 0x84, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 
-	0x60, 0xe2, 0x23, 0x3d, 0x82, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 
-	0x60, 0xe4, 0x23, 0x36, 0x88, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 
-	0x60, 0xe6, 0x63, 0x3d, 0x02, 0x0b, 0x06, 0xf8, 0x98, 0x11, 0xd0, 
-	0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x18, 0xfb, 0x40, 0x8f, 
-	0xc0, 0x82, 0xd4, 0x90, 0x8f, 0xad, 0x46, 0x10, 0x1f, 0x1b, 0x06, 
-	0xf9, 0x58, 0x10, 0x1a, 0xf2, 0xb1, 0x60, 0x90, 0x8f, 0x05, 0xa6, 
-	0x21, 0x1f, 0x13, 0x4c, 0x43, 0x3e, 0x36, 0x98, 0x86, 0x7c, 0x66, 
-	0x09, 0xa8, 0xe1, 0x06, 0xd5, 0xb8, 0x0f, 0x30, 0x98, 0x65, 0x78, 
-	0xa4, 0xc0, 0x5a, 0xe3, 0x35, 0xe2, 0x63, 0xad, 0xf1, 0x1a, 0xf1, 
-	0xb1, 0xd3, 0x88, 0x8d, 0xf8, 0x58, 0x6a, 0xc4, 0x46, 0x7c, 0x4c, 
-	0x34, 0x66, 0x23, 0x3e, 0x26, 0x1a, 0xb3, 0x11, 0x9f, 0x11, 0x83, 
-	0x04, 0x00, 0x41, 0x30, 0xa8, 0x46, 0x64, 0x3c, 0x8c, 0xc2, 0x28, 
-	0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0xa0, 0x22, 0x11, 0xf2, 0x38, 
-	0x8c, 0x82, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x83, 0xaa, 0x44, 
-	0xca, 0xc3, 0x28, 0x8c, 0x62, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 
-	0x2a, 0x13, 0x31, 0x8f, 0x82, 0x48, 0x90, 0x11, 0x83, 0x04, 0x00, 
-	0x41, 0x30, 0xa8, 0x4e, 0xe4, 0x3c, 0x8c, 0x02, 0x39, 0x6c, 0x28, 
-	0xe4, 0x63, 0x45, 0x21, 0x1f, 0x13, 0x82, 0xf8, 0x0c, 0x47, 0x04, 
-	0xe5, 0x11, 0x7c, 0xb3, 0x0c, 0x11, 0x14, 0x18, 0x7a, 0x08, 0xf4, 
-	0xb1, 0x03, 0x91, 0x8f, 0x1d, 0x8a, 0x7c, 0x4c, 0x08, 0xe2, 0x63, 
-	0x44, 0x20, 0x1f, 0x53, 0x1c, 0xf9, 0x18, 0xe3, 0xc8, 0xc7, 0x84, 
-	0x20, 0x3e, 0x86, 0x04, 0xf2, 0xb1, 0xf8, 0x28, 0xe2, 0x63, 0x81, 
-	0x10, 0x9f, 0x59, 0x82, 0x68, 0xa0, 0x62, 0x70, 0x20, 0xf4, 0x79, 
-	0x06, 0x2a, 0x06, 0x04, 0x52, 0x9f, 0x67, 0xa0, 0x62, 0x30, 0x20, 
-	0xf6, 0x79, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x60, 0xda, 0x91, 
-	0xfe, 0x10, 0x82, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0x98, 0x78, 
-	0xc4, 0x3f, 0x88, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x98, 
-	0x1f, 0xe9, 0x8f, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x18, 
-	0x30, 0xc1, 0x91, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x98, 
-	0x30, 0x01, 0x91, 0x61, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x18, 
-	0x31, 0xd1, 0x91, 0xc0, 0x82, 0x01, 0x3e, 0x66, 0x04, 0xf4, 0x19, 
-	0x31, 0x30, 0x00, 0x10, 0x04, 0x03, 0xa6, 0x4c, 0x6e, 0x24, 0xb0, 
-	0x00, 0x3f, 0xe4, 0x63, 0xfa, 0x11, 0xc4, 0xc7, 0x86, 0x41, 0x3e, 
-	0x16, 0xc0, 0x87, 0x7c, 0x2c, 0x18, 0xe4, 0x63, 0x41, 0x7d, 0xc8, 
-	0xc7, 0x84, 0xfa, 0x90, 0x8f, 0x0d, 0xf5, 0x21, 0x9f, 0x59, 0x02, 
-	0x6a, 0xb8, 0x21, 0x3f, 0x7e, 0x04, 0x0c, 0x66, 0x19, 0x26, 0x2a, 
-	0x30, 0xfe, 0xf0, 0x8f, 0xf8, 0x58, 0x00, 0x1f, 0xf2, 0xb1, 0x00, 
-	0x44, 0xe0, 0x63, 0xfe, 0x01, 0x22, 0xf1, 0xb1, 0x40, 0x3e, 0xe4, 
-	0x63, 0x81, 0x88, 0xc0, 0x67, 0xc4, 0xe0, 0x01, 0x40, 0x10, 0x0c, 
-	0x22, 0x3a, 0xc9, 0x11, 0x13, 0x29, 0x11, 0x22, 0x48, 0x91, 0x14, 
-	0x79, 0x93, 0x37, 0x89, 0x91, 0x14, 0x19, 0x4d, 0x08, 0x80, 0xd1, 
-	0x04, 0x21, 0x18, 0x4d, 0x18, 0x84, 0xd1, 0x04, 0x62, 0xb0, 0x20, 
-	0x44, 0xe4, 0x63, 0x45, 0x89, 0xc8, 0xc7, 0x02, 0x41, 0x3e, 0x66, 
-	0x98, 0x88, 0x7c, 0x2c, 0x20, 0xe4, 0x63, 0xc7, 0x89, 0xc8, 0xc7, 
-	0x02, 0x43, 0x3e, 0xb3, 0x04, 0xd4, 0x40, 0xd3, 0x00, 0x3b, 0x81, 
-	0xcd, 0x0c, 0xac, 0x52, 0x88, 0xc9, 0x41, 0x1b, 0x89, 0x4a, 0x34, 
-	0x6c, 0x10, 0x29, 0x93, 0x0d, 0x49, 0x03, 0x4d, 0x83, 0xeb, 0x04, 
-	0x36, 0x33, 0xb0, 0x4a, 0x21, 0x26, 0x07, 0x6d, 0x24, 0x2a, 0xd1, 
-	0xb0, 0x41, 0x84, 0x4c, 0x36, 0x24, 0x0d, 0x34, 0x0d, 0xac, 0x13, 
-	0xd8, 0xcc, 0xc0, 0x2a, 0x85, 0x98, 0x1c, 0xb4, 0x91, 0xa8, 0x44, 
-	0xc3, 0x06, 0x91, 0x31, 0xd9, 0x90, 0x34, 0xd0, 0x34, 0xe8, 0x4e, 
-	0xe0, 0x33, 0x03, 0xad, 0x14, 0x6a, 0x72, 0xf0, 0x46, 0x22, 0x13, 
-	0x0d, 0x1d, 0x44, 0xd4, 0x64, 0x43, 0xd2, 0x88, 0x41, 0x02, 0x80, 
-	0x20, 0x18, 0x28, 0xa6, 0x92, 0x27, 0x7f, 0xf2, 0x27, 0x72, 0x42, 
-	0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x62, 0x2a, 0x79, 0xf2, 
-	0x27, 0x7f, 0x02, 0x27, 0xc3, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 
-	0x28, 0xa6, 0x92, 0x27, 0x7f, 0xf2, 0x27, 0x71, 0x22, 0x8c, 0x18, 
-	0x24, 0x00, 0x08, 0x82, 0x81, 0x62, 0x2a, 0x79, 0xf2, 0x27, 0x7f, 
-	0x42, 0x27, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-unsigned int g_quad_ps_length = 7016;
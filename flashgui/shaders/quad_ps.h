@@ -1,10 +0,0 @@
-#pragma once
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-	extern unsigned char g_quad_ps[7016];
-	extern unsigned int g_quad_ps_length;
-#ifdef __cplusplus
-}
-#endif
\ No newline at end of file
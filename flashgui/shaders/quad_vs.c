@@ -1,576 +0,0 @@
-#include "quad_vs.h"
-
-unsigned char g_quad_vs[6260] = {
-	0x44, 0x58, 0x42, 0x43, 0x61, 0x0b, 0x91, 0xe8, 0x64, 0x1e, 0x6d, 
-	0x4f, 0x91, 0x90, 0xa9, 0x1e, 0x9e, 0x36, 0xec, 0x59, 0x01, 0x00, 
-	0x00, 0x00, 0x74, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c, 
-	0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 
-	0xb8, 0x02, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x90, 0x0d, 0x00, 
-	0x00, 0xac, 0x0d, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-	0x53, 0x47, 0x31, 0x1c, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
-	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x02, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x02, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 
-	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
-	0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
-	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x11, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 
-	0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 
-	0x54, 0x49, 0x4f, 0x4e, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 
-	0x52, 0x44, 0x00, 0x00, 0x00, 0x4f, 0x53, 0x47, 0x31, 0x40, 0x01, 
-	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-	0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x34, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x34, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x0c, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-	0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 
-	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 
-	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x07, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x05, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 
-	0x6e, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 
-	0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0xac, 0x02, 0x00, 0x00, 
-	0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x08, 
-	0x09, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x98, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 
-	0x4f, 0x4e, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 
-	0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 
-	0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 
-	0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 
-	0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 
-	0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 
-	0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 
-	0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 
-	0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 
-	0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 
-	0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 
-	0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x54, 0x45, 0x58, 
-	0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 
-	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-	0x01, 0x01, 0x42, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 
-	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x42, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
-	0x03, 0x41, 0x00, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
-	0x04, 0x00, 0x00, 0x00, 0x01, 0x04, 0x41, 0x00, 0x03, 0x00, 0x00, 
-	0x00, 0x2e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x05, 
-	0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x06, 
-	0x00, 0x00, 0x00, 0x01, 0x06, 0x41, 0x00, 0x01, 0x00, 0x00, 0x00, 
-	0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x07, 0x44, 
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x00, 0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x49, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x42, 0x00, 
-	0x03, 0x02, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-	0x00, 0x01, 0x01, 0x62, 0x00, 0x03, 0x02, 0x00, 0x00, 0x5b, 0x00, 
-	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x42, 0x00, 0x03, 
-	0x02, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-	0x01, 0x02, 0x61, 0x00, 0x03, 0x02, 0x00, 0x00, 0x6d, 0x00, 0x00, 
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x71, 0x00, 0x03, 0x02, 
-	0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 
-	0x03, 0x44, 0x00, 0x03, 0x02, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 
-	0x06, 0x00, 0x00, 0x00, 0x01, 0x04, 0x41, 0x00, 0x01, 0x01, 0x00, 
-	0x00, 0x88, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x05, 
-	0x44, 0x00, 0x03, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2f, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x4f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0f, 0x02, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
-	0x80, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
-	0x80, 0x00, 0x53, 0x54, 0x41, 0x54, 0x1c, 0x08, 0x00, 0x00, 0x60, 
-	0x00, 0x01, 0x00, 0x07, 0x02, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 
-	0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 
-	0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xfe, 0x01, 
-	0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 
-	0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 
-	0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 
-	0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 
-	0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 
-	0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 
-	0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 
-	0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 
-	0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 
-	0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 
-	0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 
-	0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 
-	0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 
-	0x2a, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 
-	0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 
-	0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 
-	0x80, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 0x08, 
-	0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 0x40, 0x10, 0x44, 0x41, 0x90, 
-	0x51, 0x0c, 0x82, 0x20, 0x88, 0x82, 0x20, 0xa4, 0x18, 0x00, 0x41, 
-	0x10, 0xc5, 0x40, 0x4a, 0x31, 0x00, 0x82, 0x20, 0x0a, 0x82, 0x98, 
-	0x32, 0x0c, 0xc4, 0x40, 0xce, 0x51, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 
-	0x48, 0x3e, 0xb7, 0x51, 0xc5, 0x4a, 0x4c, 0x7e, 0x71, 0xdb, 0x88, 
-	0x18, 0x86, 0x61, 0xa0, 0xe2, 0x9e, 0xe1, 0xf2, 0x27, 0xec, 0x21, 
-	0x24, 0x3f, 0x04, 0x9a, 0x61, 0x21, 0x50, 0x10, 0x15, 0x02, 0x22, 
-	0x24, 0x82, 0xa6, 0x52, 0x0c, 0xc4, 0x30, 0x0c, 0x54, 0xcd, 0x11, 
-	0x04, 0xc5, 0x90, 0x88, 0x82, 0x20, 0x2e, 0xc2, 0x06, 0x02, 0x86, 
-	0x11, 0x88, 0x21, 0x09, 0xb6, 0xb3, 0x0e, 0x47, 0x9a, 0x16, 0x00, 
-	0x73, 0xa8, 0xc9, 0x6f, 0x23, 0xa0, 0x91, 0x0a, 0x27, 0x62, 0xb8, 
-	0x0d, 0x05, 0x1c, 0x75, 0x29, 0x42, 0x00, 0x13, 0x14, 0x72, 0xc0, 
-	0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 
-	0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 
-	0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 
-	0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 
-	0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 
-	0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 
-	0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 
-	0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 
-	0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 
-	0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 
-	0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 
-	0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 
-	0x40, 0x07, 0x43, 0x9e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06, 0x10, 0x00, 0x01, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x10, 0x20, 0x00, 
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x28, 
-	0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0xe4, 0x61, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0xc8, 0xe3, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 0x02, 0x02, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x05, 0x04, 0x40, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x0c, 
-	0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 
-	0x40, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18, 
-	0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 
-	0x22, 0x4a, 0x60, 0x04, 0xa0, 0x18, 0x0a, 0x30, 0xa0, 0x08, 0x0a, 
-	0xa1, 0x0c, 0xca, 0xa1, 0x24, 0x4a, 0xa1, 0x3c, 0x0a, 0xa2, 0x7c, 
-	0x0a, 0x38, 0xa0, 0x44, 0x4a, 0x85, 0x8a, 0x92, 0x18, 0x01, 0x28, 
-	0x82, 0x12, 0x28, 0x84, 0x52, 0x28, 0x03, 0xea, 0x66, 0x00, 0xc8, 
-	0x9b, 0x01, 0xa0, 0x6f, 0x2c, 0x31, 0x00, 0x03, 0xec, 0x7b, 0x03, 
-	0x00, 0x78, 0x85, 0x97, 0x00, 0x80, 0x17, 0x79, 0x21, 0x00, 0x78, 
-	0xc1, 0x00, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x41, 0x02, 
-	0x04, 0x11, 0x10, 0x84, 0x40, 0x10, 0x0c, 0x5e, 0x10, 0x14, 0x00, 
-	0x00, 0x00, 0x41, 0x10, 0x0c, 0x40, 0x10, 0x04, 0x05, 0x10, 0x04, 
-	0x41, 0x02, 0x04, 0x41, 0x10, 0x01, 0x79, 0x18, 0x00, 0x00, 0xd1, 
-	0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 
-	0x8f, 0x0c, 0x6f, 0xec, 0xed, 0x4d, 0x0c, 0x24, 0xc6, 0x05, 0xc7, 
-	0x45, 0xa6, 0x06, 0xa6, 0xc6, 0x65, 0x46, 0x06, 0x04, 0x45, 0x2c, 
-	0x06, 0xc6, 0x26, 0x2c, 0xc7, 0x26, 0x86, 0x2c, 0x65, 0x43, 0x10, 
-	0x4c, 0x10, 0x88, 0x64, 0x82, 0x40, 0x28, 0x1b, 0x84, 0x81, 0xd8, 
-	0x20, 0x10, 0x04, 0x05, 0xbb, 0xb9, 0x09, 0x02, 0xb1, 0x6c, 0x18, 
-	0x0e, 0x84, 0x98, 0x20, 0x78, 0x61, 0xc0, 0x85, 0x4a, 0x2e, 0xcc, 
-	0x6d, 0xce, 0xec, 0x4d, 0xae, 0x6d, 0x48, 0x68, 0x82, 0x40, 0x30, 
-	0x1b, 0x10, 0x42, 0x59, 0x08, 0x62, 0x60, 0x80, 0x0d, 0x41, 0xb3, 
-	0x81, 0x00, 0x00, 0x07, 0x98, 0x20, 0x74, 0x60, 0xc0, 0x08, 0x4e, 
-	0xee, 0x4d, 0xad, 0x6c, 0x8c, 0x2e, 0xed, 0xcd, 0xed, 0xab, 0x2d, 
-	0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0x82, 0x40, 0x34, 0x13, 0x04, 0xc2, 
-	0xd9, 0x30, 0x4c, 0x93, 0x34, 0x41, 0x20, 0x9e, 0x09, 0x02, 0x01, 
-	0x4d, 0x10, 0x88, 0x68, 0x03, 0x82, 0x44, 0x12, 0x55, 0x11, 0xd6, 
-	0xb5, 0x41, 0x60, 0xb0, 0x0d, 0x03, 0x01, 0x65, 0x13, 0x04, 0x01, 
-	0xd8, 0x00, 0x6c, 0x18, 0x08, 0x8e, 0xdb, 0x10, 0x74, 0x1b, 0x86, 
-	0x61, 0xf3, 0x26, 0x08, 0x9f, 0x18, 0x6c, 0x08, 0xc0, 0x80, 0x44, 
-	0x5b, 0x58, 0x9a, 0x1b, 0x11, 0xa8, 0xa7, 0xa9, 0x24, 0xaa, 0xa4, 
-	0x27, 0xa7, 0x09, 0x42, 0x91, 0x4d, 0x10, 0x0a, 0x6d, 0x43, 0x40, 
-	0x4c, 0x10, 0x8a, 0x6d, 0x83, 0x50, 0x55, 0x1b, 0x16, 0x62, 0x0c, 
-	0xc8, 0xa0, 0x0c, 0xcc, 0xa0, 0x0c, 0x86, 0x33, 0x20, 0xca, 0x00, 
-	0x0d, 0x88, 0x50, 0x15, 0x61, 0x0d, 0x3d, 0x3d, 0x49, 0x11, 0x6d, 
-	0x08, 0x86, 0x0d, 0xcb, 0xa0, 0x06, 0x64, 0x50, 0x06, 0x6b, 0x50, 
-	0x06, 0xc3, 0x19, 0x0c, 0x65, 0x80, 0x06, 0x1b, 0x02, 0x69, 0xc3, 
-	0x22, 0xa9, 0x01, 0x19, 0x94, 0x41, 0x1b, 0x94, 0xc1, 0x70, 0x06, 
-	0x52, 0x19, 0xa0, 0xc1, 0x86, 0xa0, 0x9a, 0x20, 0x14, 0xdc, 0x06, 
-	0xa1, 0x1a, 0x36, 0x2c, 0x95, 0x1a, 0x90, 0x41, 0x19, 0xbc, 0x41, 
-	0x19, 0x0c, 0x70, 0x50, 0x95, 0x41, 0x1c, 0x6c, 0x08, 0xa6, 0x0d, 
-	0xcb, 0xa4, 0x06, 0x64, 0x50, 0x06, 0x73, 0x50, 0x06, 0x03, 0x1c, 
-	0x4c, 0x65, 0x10, 0x07, 0x13, 0x04, 0x42, 0xda, 0x10, 0xd4, 0xc1, 
-	0x04, 0xa1, 0xe8, 0x26, 0x08, 0xc4, 0xb4, 0x41, 0xa8, 0xf0, 0x60, 
-	0xc3, 0x52, 0x07, 0x6a, 0x40, 0x06, 0x65, 0x60, 0x07, 0x65, 0x30, 
-	0xdc, 0x41, 0x1d, 0x94, 0x41, 0x1e, 0x4c, 0x10, 0x0a, 0x6f, 0x43, 
-	0x80, 0x6c, 0x58, 0x10, 0x35, 0xd8, 0x83, 0x32, 0xe0, 0x83, 0x32, 
-	0x18, 0xe0, 0x00, 0x29, 0x83, 0x38, 0xd8, 0x10, 0x58, 0x1b, 0x16, 
-	0x4b, 0x0d, 0xc8, 0xa0, 0x0c, 0xfc, 0xa0, 0x0c, 0x86, 0x3b, 0xb0, 
-	0xca, 0x20, 0x0f, 0x36, 0x20, 0x69, 0xc0, 0x06, 0x6e, 0x20, 0x07, 
-	0x74, 0xa0, 0x07, 0x7d, 0xf0, 0x07, 0x5c, 0xa6, 0xac, 0xbe, 0xa0, 
-	0xde, 0xe6, 0xd2, 0xe8, 0xd2, 0xde, 0xdc, 0x26, 0x08, 0xc5, 0xb7, 
-	0x61, 0x21, 0x42, 0x81, 0x0c, 0x44, 0xc1, 0x0c, 0xee, 0x60, 0xb8, 
-	0x03, 0xa2, 0x0c, 0xf2, 0x60, 0xc3, 0x32, 0xa8, 0x01, 0x19, 0x94, 
-	0x81, 0x19, 0x9c, 0xc1, 0x70, 0x06, 0x43, 0x19, 0xa0, 0xc1, 0x86, 
-	0x45, 0x52, 0x03, 0x32, 0x28, 0x83, 0x35, 0x38, 0x83, 0xe1, 0x0c, 
-	0x86, 0x33, 0x40, 0x83, 0x0d, 0x4b, 0xa5, 0x06, 0x64, 0x50, 0x06, 
-	0x6d, 0x70, 0x06, 0xc3, 0x19, 0x48, 0x65, 0x80, 0x06, 0x1b, 0x96, 
-	0x49, 0x0d, 0xc8, 0xa0, 0x0c, 0xde, 0xe0, 0x0c, 0x06, 0x38, 0x90, 
-	0xce, 0x20, 0x0e, 0x36, 0x2c, 0x75, 0xa0, 0x06, 0x64, 0x50, 0x06, 
-	0x73, 0x70, 0x06, 0x03, 0x1c, 0x48, 0xa2, 0x10, 0x07, 0x1b, 0x16, 
-	0x44, 0x0d, 0xc8, 0xa0, 0x0c, 0xec, 0xe0, 0x0c, 0x86, 0x3b, 0xa8, 
-	0xca, 0x20, 0x0f, 0x36, 0x2c, 0x96, 0x1a, 0xec, 0x41, 0x19, 0xf0, 
-	0x01, 0x1c, 0x0c, 0x70, 0x30, 0x95, 0x41, 0x1c, 0x4c, 0x10, 0x08, 
-	0x6a, 0xc3, 0xb2, 0x0a, 0x6a, 0x40, 0x06, 0x65, 0xe0, 0x07, 0x67, 
-	0x30, 0xdc, 0x41, 0x1d, 0x94, 0x41, 0x1e, 0x6c, 0x48, 0x46, 0x81, 
-	0x14, 0x4a, 0xc1, 0x14, 0x4e, 0x01, 0x15, 0x52, 0x41, 0x15, 0x58, 
-	0x61, 0xc3, 0x00, 0x0a, 0xad, 0x00, 0x6c, 0x28, 0x36, 0x31, 0x70, 
-	0x85, 0x07, 0x20, 0x22, 0x26, 0x17, 0xe6, 0x36, 0x86, 0x56, 0x36, 
-	0x47, 0xc3, 0x8c, 0xed, 0x2d, 0x8c, 0x6e, 0x6e, 0x82, 0x40, 0x54, 
-	0x2c, 0xd2, 0xdc, 0xe6, 0xe8, 0xe6, 0x26, 0x08, 0x84, 0x45, 0x22, 
-	0xcd, 0x8d, 0x6e, 0x8e, 0xc6, 0x5c, 0xda, 0xd9, 0x17, 0x1b, 0xd9, 
-	0x04, 0x81, 0xb8, 0x68, 0xcc, 0xa5, 0x9d, 0x7d, 0xcd, 0xd1, 0x4d, 
-	0x10, 0x08, 0x8c, 0x45, 0x5d, 0x9a, 0x1b, 0xdd, 0xdc, 0x06, 0x07, 
-	0x16, 0x86, 0x58, 0x90, 0x85, 0x59, 0xa0, 0x85, 0x5a, 0x18, 0x6c, 
-	0xe1, 0x16, 0x70, 0x21, 0x17, 0x74, 0x61, 0xa8, 0xc2, 0xc6, 0x66, 
-	0xd7, 0xe6, 0x92, 0x46, 0x56, 0xe6, 0x46, 0x37, 0x25, 0x08, 0xaa, 
-	0x90, 0xe1, 0xb9, 0xd8, 0x95, 0xc9, 0xcd, 0xa5, 0xbd, 0xb9, 0x4d, 
-	0x09, 0x88, 0x26, 0x64, 0x78, 0x2e, 0x76, 0x61, 0x6c, 0x76, 0x65, 
-	0x72, 0x53, 0x82, 0xa2, 0x0e, 0x19, 0x9e, 0xcb, 0x1c, 0x5a, 0x18, 
-	0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59, 0x19, 0xdb, 0x94, 0x00, 0x29, 
-	0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7, 0x56, 0x27, 0x37, 0x56, 
-	0x36, 0x37, 0x25, 0x70, 0x2a, 0x91, 0xe1, 0xb9, 0xd0, 0xe5, 0xc1, 
-	0x95, 0x05, 0xb9, 0xb9, 0xbd, 0xd1, 0x85, 0xd1, 0xa5, 0xbd, 0xb9, 
-	0xcd, 0x4d, 0x11, 0x32, 0xaf, 0x0e, 0x19, 0x9e, 0x8b, 0x5d, 0x5a, 
-	0xd9, 0x5d, 0x12, 0xd9, 0x14, 0x5d, 0x18, 0x5d, 0xd9, 0x94, 0x00, 
-	0x0c, 0xea, 0x90, 0xe1, 0xb9, 0x94, 0xb9, 0xd1, 0xc9, 0xe5, 0x41, 
-	0xbd, 0xa5, 0xb9, 0xd1, 0xcd, 0x4d, 0x09, 0x5c, 0xa1, 0x0b, 0x19, 
-	0x9e, 0xcb, 0xd8, 0x5b, 0x9d, 0x1b, 0x5d, 0x99, 0xdc, 0xdc, 0x94, 
-	0x40, 0x17, 0x00, 0x79, 0x18, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 
-	0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 
-	0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 
-	0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 
-	0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 
-	0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 
-	0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 
-	0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 
-	0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 
-	0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 
-	0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 
-	0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 
-	0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 
-	0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 
-	0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 
-	0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 
-	0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 
-	0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 
-	0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 
-	0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 
-	0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 
-	0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 
-	0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 
-	0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 
-	0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x8c, 0xc8, 
-	0x21, 0x07, 0x7c, 0x70, 0x03, 0x72, 0x10, 0x87, 0x73, 0x70, 0x03, 
-	0x7b, 0x08, 0x07, 0x79, 0x60, 0x87, 0x70, 0xc8, 0x87, 0x77, 0xa8, 
-	0x07, 0x7a, 0x98, 0x81, 0x3c, 0xe4, 0x80, 0x0f, 0x6e, 0x40, 0x0f, 
-	0xe5, 0xd0, 0x0e, 0xf0, 0x30, 0x83, 0x81, 0xc8, 0x01, 0x1f, 0xdc, 
-	0x40, 0x1c, 0xe4, 0xa1, 0x1c, 0xc2, 0x61, 0x1d, 0xdc, 0x40, 0x1c, 
-	0xe4, 0x01, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x24, 0x00, 
-	0x00, 0x00, 0x66, 0xb0, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50, 
-	0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 
-	0x17, 0xb7, 0x6d, 0x08, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x11, 
-	0x01, 0x4c, 0x44, 0x08, 0x34, 0xc3, 0x42, 0x58, 0xc0, 0x34, 0x5c, 
-	0xbe, 0xf3, 0xf8, 0x8b, 0x03, 0x0c, 0x62, 0xf3, 0x50, 0x93, 0x5f, 
-	0xdc, 0xb6, 0x09, 0x4c, 0xc3, 0xe5, 0x3b, 0x8f, 0xbf, 0x38, 0xc0, 
-	0x20, 0x36, 0x0f, 0x35, 0xf9, 0xc8, 0x6d, 0xdb, 0x40, 0x35, 0x5c, 
-	0xbe, 0xf3, 0xf8, 0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35, 
-	0xf9, 0xc5, 0x6d, 0x1b, 0x41, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0xd2, 
-	0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35, 0xf9, 0xc8, 0x6d, 0xdb, 
-	0x81, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 
-	0x61, 0x7e, 0x71, 0xdb, 0x56, 0xf0, 0x0c, 0x97, 0xef, 0x3c, 0x3e, 
-	0xd5, 0x00, 0x11, 0xe6, 0x17, 0xb7, 0x6d, 0x00, 0x04, 0x03, 0x20, 
-	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 
-	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x2d, 0x5e, 
-	0x97, 0xdf, 0x1e, 0xc3, 0x3c, 0xdf, 0x7c, 0x0b, 0x07, 0x3a, 0xe4, 
-	0x89, 0x41, 0x44, 0x58, 0x49, 0x4c, 0xc0, 0x0a, 0x00, 0x00, 0x60, 
-	0x00, 0x01, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 
-	0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0x00, 
-	0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xa7, 0x02, 
-	0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 
-	0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 
-	0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 
-	0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 
-	0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 
-	0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 
-	0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 
-	0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 
-	0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 
-	0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 
-	0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 
-	0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18, 
-	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 
-	0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 
-	0x2b, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 
-	0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 
-	0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 
-	0x84, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 0x08, 
-	0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 0x40, 0x10, 0x44, 0x41, 0x90, 
-	0x51, 0x0c, 0x82, 0x20, 0x88, 0x82, 0x20, 0xa4, 0x18, 0x00, 0x41, 
-	0x10, 0xc5, 0x40, 0x4a, 0x31, 0x00, 0x82, 0x20, 0x0a, 0x82, 0x98, 
-	0x32, 0x0c, 0xc4, 0x40, 0xce, 0x51, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 
-	0x48, 0x3e, 0xb7, 0x51, 0xc5, 0x4a, 0x4c, 0x7e, 0x71, 0xdb, 0x88, 
-	0x18, 0x86, 0x61, 0xa0, 0xe2, 0x9e, 0xe1, 0xf2, 0x27, 0xec, 0x21, 
-	0x24, 0x3f, 0x04, 0x9a, 0x61, 0x21, 0x50, 0x10, 0x15, 0x02, 0x22, 
-	0x24, 0x82, 0xa6, 0x52, 0x0c, 0xc4, 0x30, 0x0c, 0x54, 0xcd, 0x11, 
-	0x04, 0xc5, 0x90, 0x88, 0x82, 0x20, 0x2e, 0xc2, 0x06, 0x02, 0x86, 
-	0x11, 0x88, 0x21, 0x09, 0xb6, 0xb3, 0x0e, 0x47, 0x9a, 0x16, 0x00, 
-	0x73, 0xa8, 0xc9, 0x6f, 0x23, 0xa0, 0x91, 0x0a, 0x27, 0x62, 0xb8, 
-	0x0d, 0x05, 0x1c, 0x75, 0x29, 0x42, 0x4c, 0x01, 0x00, 0x00, 0x00, 
-	0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 
-	0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 
-	0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 
-	0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 
-	0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 
-	0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 
-	0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 
-	0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 
-	0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 
-	0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 
-	0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 
-	0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 
-	0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06, 
-	0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 
-	0x79, 0x10, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x18, 0xf2, 0x28, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x30, 0xe4, 0x61, 0x80, 0x00, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xe3, 0x00, 0x01, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 0x02, 
-	0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 
-	0x4f, 0x05, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x43, 0x1e, 0x0c, 0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xb2, 0x40, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
-	0x32, 0x1e, 0x98, 0x14, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 
-	0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0x60, 0x04, 0xa0, 0x24, 0x8a, 
-	0xa1, 0x00, 0x03, 0xca, 0xa0, 0x08, 0x0a, 0xa1, 0x14, 0xca, 0xa3, 
-	0x1c, 0x0a, 0x82, 0x8a, 0x92, 0x18, 0x01, 0x28, 0x82, 0x12, 0x28, 
-	0x84, 0x52, 0x28, 0x03, 0xf2, 0x66, 0x00, 0xe8, 0x1b, 0x4b, 0x0c, 
-	0xc0, 0x00, 0xfb, 0xde, 0x00, 0x00, 0x5e, 0xe1, 0x25, 0x00, 0xe0, 
-	0x45, 0x5e, 0x08, 0x00, 0x5e, 0x30, 0x00, 0x00, 0x00, 0x04, 0x05, 
-	0x00, 0x00, 0x40, 0x90, 0x00, 0x41, 0x04, 0x04, 0x21, 0x10, 0x04, 
-	0x83, 0x17, 0x04, 0x05, 0x00, 0x00, 0x40, 0x10, 0x04, 0x03, 0x10, 
-	0x04, 0x41, 0x01, 0x04, 0x41, 0x90, 0x00, 0x41, 0x10, 0x44, 0x00, 
-	0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x1a, 
-	0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x8f, 0x0c, 0x6f, 0xec, 
-	0xed, 0x4d, 0x0c, 0x24, 0xc6, 0x05, 0xc7, 0x45, 0xa6, 0x06, 0xa6, 
-	0xc6, 0x65, 0x46, 0x06, 0x04, 0x45, 0x2c, 0x06, 0xc6, 0x26, 0x2c, 
-	0xc7, 0x26, 0x86, 0x2c, 0x65, 0x43, 0x10, 0x4c, 0x10, 0x88, 0x64, 
-	0x82, 0x40, 0x28, 0x1b, 0x84, 0x81, 0x98, 0x20, 0x10, 0xcb, 0x06, 
-	0x61, 0x30, 0x28, 0xd8, 0xcd, 0x4d, 0x10, 0x08, 0x66, 0xc3, 0x80, 
-	0x24, 0xc4, 0x04, 0xc1, 0xe3, 0x08, 0x4c, 0x10, 0x88, 0x66, 0x03, 
-	0x42, 0x2c, 0x0c, 0x41, 0x0c, 0x0d, 0xb0, 0x21, 0x70, 0x36, 0x10, 
-	0x00, 0xf0, 0x00, 0x13, 0x84, 0xaf, 0xdb, 0x10, 0x44, 0x13, 0x04, 
-	0x01, 0x20, 0xd1, 0x16, 0x96, 0xe6, 0x46, 0x04, 0xea, 0x69, 0x2a, 
-	0x89, 0x2a, 0xe9, 0xc9, 0x69, 0x82, 0x50, 0x54, 0x13, 0x84, 0xc2, 
-	0xda, 0x10, 0x10, 0x13, 0x84, 0xe2, 0x9a, 0x20, 0x10, 0xce, 0x06, 
-	0x41, 0xd3, 0x36, 0x2c, 0x44, 0x65, 0x5d, 0xd8, 0x35, 0x64, 0xc4, 
-	0xb5, 0x11, 0xa1, 0x2a, 0xc2, 0x1a, 0x7a, 0x7a, 0x92, 0x22, 0xda, 
-	0x10, 0x0c, 0x1b, 0x96, 0xa1, 0xb3, 0x2e, 0xef, 0x1a, 0xb2, 0xe1, 
-	0xda, 0x26, 0x08, 0xc4, 0xb3, 0x21, 0x00, 0x83, 0x0d, 0x0b, 0x18, 
-	0x74, 0xd6, 0x15, 0x06, 0xd7, 0x90, 0x81, 0xc1, 0xb5, 0x6d, 0x08, 
-	0xb4, 0x09, 0x42, 0x81, 0x6d, 0x10, 0xb4, 0x61, 0xc3, 0xa2, 0x75, 
-	0xd6, 0x35, 0x06, 0xd7, 0x40, 0x06, 0xda, 0x55, 0x06, 0x13, 0x04, 
-	0x02, 0xda, 0x10, 0x9c, 0xc1, 0x86, 0xe5, 0x0c, 0x3a, 0xeb, 0x42, 
-	0x83, 0x6b, 0x20, 0x83, 0x33, 0xb8, 0xca, 0x60, 0x82, 0x40, 0x44, 
-	0x1b, 0x02, 0x35, 0x98, 0x20, 0x14, 0xd9, 0x04, 0x81, 0x90, 0x36, 
-	0x08, 0x5a, 0x1b, 0x6c, 0x58, 0xd4, 0xa0, 0xb3, 0xae, 0x35, 0xb8, 
-	0x06, 0x36, 0x50, 0x83, 0xcb, 0x0d, 0x26, 0x08, 0x85, 0xb6, 0x21, 
-	0x48, 0x36, 0x2c, 0x49, 0x07, 0x07, 0x57, 0x1c, 0x5c, 0x03, 0x19, 
-	0x24, 0x57, 0x19, 0x4c, 0x10, 0x88, 0x69, 0x43, 0x30, 0x07, 0x1b, 
-	0x96, 0x39, 0xe8, 0xac, 0x8b, 0x0e, 0xae, 0x81, 0x0d, 0xe6, 0xe0, 
-	0x72, 0x83, 0x0d, 0x08, 0xf7, 0x89, 0x81, 0x19, 0xa4, 0xc1, 0x1b, 
-	0xc8, 0x41, 0x1d, 0x70, 0x99, 0xb2, 0xfa, 0x82, 0x7a, 0x9b, 0x4b, 
-	0xa3, 0x4b, 0x7b, 0x73, 0x9b, 0x20, 0x14, 0xdb, 0x86, 0x85, 0xb8, 
-	0x03, 0x0b, 0x0f, 0x30, 0x36, 0x18, 0xd8, 0x80, 0xb8, 0xdc, 0x60, 
-	0xc3, 0x32, 0x74, 0xd6, 0x85, 0x65, 0x43, 0x36, 0x5c, 0xdb, 0x86, 
-	0x05, 0x0c, 0x3a, 0xeb, 0xf2, 0xb2, 0x21, 0x1b, 0xb2, 0x6d, 0xc3, 
-	0xa2, 0x75, 0xd6, 0x15, 0x06, 0xd9, 0x90, 0x81, 0xc1, 0xb5, 0x6d, 
-	0x58, 0xce, 0xa0, 0xb3, 0xae, 0x31, 0xc8, 0x06, 0x32, 0x00, 0x83, 
-	0xac, 0x0c, 0x36, 0x2c, 0x6a, 0xd0, 0x59, 0x17, 0x1a, 0x64, 0x03, 
-	0x19, 0x80, 0x01, 0x1e, 0x94, 0xc1, 0x86, 0x25, 0xe9, 0xac, 0x6b, 
-	0x0d, 0xb2, 0x81, 0x0d, 0xb4, 0xcb, 0x0d, 0x36, 0x2c, 0x73, 0xd0, 
-	0xc1, 0xc1, 0x15, 0x07, 0x64, 0x30, 0x90, 0xc1, 0x19, 0x5c, 0x65, 
-	0x30, 0x41, 0x20, 0xa8, 0x0d, 0x4b, 0x28, 0x74, 0xd6, 0x45, 0x07, 
-	0xd9, 0xc0, 0x06, 0x6a, 0x70, 0xb9, 0xc1, 0x86, 0x24, 0x0f, 0xf4, 
-	0x60, 0x0f, 0xf8, 0xa0, 0x0f, 0xfc, 0xe0, 0x0f, 0x40, 0x41, 0x14, 
-	0x36, 0x0c, 0x76, 0x30, 0x0a, 0xc0, 0x86, 0x62, 0xa2, 0x48, 0x01, 
-	0x02, 0xaa, 0xb0, 0xb1, 0xd9, 0xb5, 0xb9, 0xa4, 0x91, 0x95, 0xb9, 
-	0xd1, 0x4d, 0x09, 0x82, 0x2a, 0x64, 0x78, 0x2e, 0x76, 0x65, 0x72, 
-	0x73, 0x69, 0x6f, 0x6e, 0x53, 0x02, 0xa2, 0x09, 0x19, 0x9e, 0x8b, 
-	0x5d, 0x18, 0x9b, 0x5d, 0x99, 0xdc, 0x94, 0xc0, 0xa8, 0x43, 0x86, 
-	0xe7, 0x32, 0x87, 0x16, 0x46, 0x56, 0x26, 0xd7, 0xf4, 0x46, 0x56, 
-	0xc6, 0x36, 0x25, 0x48, 0xca, 0x90, 0xe1, 0xb9, 0xc8, 0x95, 0xcd, 
-	0xbd, 0xd5, 0xc9, 0x8d, 0x95, 0xcd, 0x4d, 0x09, 0x9e, 0x3a, 0x64, 
-	0x78, 0x2e, 0x76, 0x69, 0x65, 0x77, 0x49, 0x64, 0x53, 0x74, 0x61, 
-	0x74, 0x65, 0x53, 0x82, 0xa8, 0x0e, 0x19, 0x9e, 0x4b, 0x99, 0x1b, 
-	0x9d, 0x5c, 0x1e, 0xd4, 0x5b, 0x9a, 0x1b, 0xdd, 0xdc, 0x94, 0x80, 
-	0x14, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x51, 0x00, 0x00, 
-	0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 
-	0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 
-	0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 
-	0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 
-	0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 
-	0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 
-	0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 
-	0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 
-	0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 
-	0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 
-	0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 
-	0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 
-	0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 
-	0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 
-	0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 
-	0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 
-	0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 
-	0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 
-	0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 
-	0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 
-	0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 
-	0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 
-	0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 
-	0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x8c, 
-	0xc8, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x72, 0x10, 0x87, 0x73, 0x70, 
-	0x03, 0x7b, 0x08, 0x07, 0x79, 0x60, 0x87, 0x70, 0xc8, 0x87, 0x77, 
-	0xa8, 0x07, 0x7a, 0x98, 0x81, 0x3c, 0xe4, 0x80, 0x0f, 0x6e, 0x40, 
-	0x0f, 0xe5, 0xd0, 0x0e, 0xf0, 0x30, 0x83, 0x81, 0xc8, 0x01, 0x1f, 
-	0xdc, 0x40, 0x1c, 0xe4, 0xa1, 0x1c, 0xc2, 0x61, 0x1d, 0xdc, 0x40, 
-	0x1c, 0xe4, 0x01, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x24, 
-	0x00, 0x00, 0x00, 0x66, 0xb0, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 
-	0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 
-	0xe6, 0x17, 0xb7, 0x6d, 0x08, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 
-	0x11, 0x01, 0x4c, 0x44, 0x08, 0x34, 0xc3, 0x42, 0x58, 0xc0, 0x34, 
-	0x5c, 0xbe, 0xf3, 0xf8, 0x8b, 0x03, 0x0c, 0x62, 0xf3, 0x50, 0x93, 
-	0x5f, 0xdc, 0xb6, 0x09, 0x4c, 0xc3, 0xe5, 0x3b, 0x8f, 0xbf, 0x38, 
-	0xc0, 0x20, 0x36, 0x0f, 0x35, 0xf9, 0xc8, 0x6d, 0xdb, 0x40, 0x35, 
-	0x5c, 0xbe, 0xf3, 0xf8, 0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 
-	0x35, 0xf9, 0xc5, 0x6d, 0x1b, 0x41, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 
-	0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35, 0xf9, 0xc8, 0x6d, 
-	0xdb, 0x81, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 
-	0x10, 0x61, 0x7e, 0x71, 0xdb, 0x56, 0xf0, 0x0c, 0x97, 0xef, 0x3c, 
-	0x3e, 0xd5, 0x00, 0x11, 0xe6, 0x17, 0xb7, 0x6d, 0x00, 0x04, 0x03, 
-	0x20, 0x0d, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0xe6, 0x00, 0x00, 
-	0x00, 0x13, 0x04, 0x43, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 
-	0x00, 0x00, 0x74, 0x8d, 0x00, 0x10, 0x51, 0x18, 0xa5, 0x31, 0x03, 
-	0x50, 0x5c, 0x65, 0x57, 0x72, 0x34, 0x8c, 0x00, 0x8c, 0x11, 0x80, 
-	0x20, 0x08, 0xc2, 0xbf, 0x30, 0x46, 0x00, 0x82, 0x20, 0x08, 0x7f, 
-	0x00, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x80, 0x81, 0x01, 0x11, 
-	0x79, 0x9e, 0x32, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x06, 0x1a, 
-	0x64, 0xd6, 0x37, 0x21, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 
-	0xa4, 0x81, 0x76, 0x81, 0x81, 0x94, 0x8c, 0x18, 0x24, 0x00, 0x08, 
-	0x82, 0x81, 0xa1, 0x06, 0x1b, 0x16, 0x06, 0x94, 0x32, 0x62, 0x90, 
-	0x00, 0x20, 0x08, 0x06, 0xc6, 0x1a, 0x70, 0x99, 0x18, 0x44, 0xcb, 
-	0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x20, 0x6b, 0xd0, 0x85, 0xc1, 
-	0x18, 0x5c, 0xcc, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0x6d, 
-	0xe0, 0x75, 0x64, 0x80, 0x35, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 
-	0x60, 0xb8, 0xc1, 0xe7, 0x95, 0xc1, 0xe5, 0x8c, 0x18, 0x24, 0x00, 
-	0x08, 0x82, 0x81, 0xf1, 0x06, 0x60, 0xf0, 0x99, 0x41, 0xf6, 0x8c, 
-	0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x01, 0x07, 0x61, 0x00, 0x06, 
-	0x67, 0x60, 0x41, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xc4, 
-	0x81, 0x18, 0x88, 0x01, 0x1a, 0x70, 0xd1, 0x88, 0x41, 0x02, 0x80, 
-	0x20, 0x18, 0x18, 0x72, 0x30, 0x06, 0x65, 0x90, 0x06, 0x9d, 0x34, 
-	0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0xc6, 0x1c, 0x90, 0x41, 0x19, 
-	0xa8, 0x81, 0x37, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x41, 
-	0x07, 0x65, 0x60, 0x06, 0x6b, 0xd0, 0x51, 0x23, 0x06, 0x09, 0x00, 
-	0x82, 0x60, 0x60, 0xd4, 0x81, 0x19, 0xb4, 0x01, 0x1b, 0x80, 0x41, 
-	0x35, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x86, 0x1d, 0x9c, 0x81, 
-	0x1b, 0xb4, 0xc1, 0x67, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 
-	0x71, 0x07, 0x68, 0xe0, 0x06, 0x6e, 0x20, 0x06, 0xd7, 0x88, 0x41, 
-	0x02, 0x80, 0x20, 0x18, 0x18, 0x78, 0x90, 0x06, 0x6f, 0xf0, 0x06, 
-	0x61, 0x80, 0x99, 0x60, 0xc8, 0xc7, 0x04, 0x43, 0x3e, 0x26, 0x18, 
-	0xf0, 0x31, 0xc1, 0x80, 0xcf, 0x70, 0xc4, 0x92, 0x39, 0xdf, 0x70, 
-	0x83, 0x64, 0x07, 0x62, 0x50, 0x81, 0xa0, 0xb3, 0x0c, 0x81, 0x10, 
-	0x58, 0xa3, 0xc9, 0xc7, 0x9a, 0x4d, 0x3e, 0xb6, 0x74, 0xf0, 0xb1, 
-	0x00, 0x92, 0x8f, 0x31, 0x1f, 0x7c, 0x2c, 0x88, 0xe4, 0x33, 0x62, 
-	0x60, 0x00, 0x20, 0x08, 0x06, 0x8e, 0x28, 0x9c, 0x01, 0x35, 0x62, 
-	0x60, 0x00, 0x20, 0x08, 0x06, 0xce, 0x28, 0xa4, 0x41, 0x65, 0x41, 
-	0x21, 0x1f, 0x1b, 0x08, 0xf9, 0x18, 0x71, 0xc8, 0xc7, 0x08, 0x43, 
-	0x3e, 0x76, 0x31, 0xf0, 0xb1, 0x80, 0x88, 0x8f, 0x05, 0x06, 0x7c, 
-	0x2c, 0x73, 0xe0, 0x63, 0x81, 0x01, 0x1f, 0x0b, 0x0c, 0xf8, 0xcc, 
-	0x12, 0x08, 0x03, 0x15, 0x03, 0x12, 0xb8, 0x01, 0x30, 0x50, 0x31, 
-	0x10, 0x81, 0x1b, 0x00, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x30, 
-	0xbd, 0x82, 0x1c, 0xb4, 0xc1, 0x2a, 0x8c, 0x26, 0x04, 0xc0, 0x68, 
-	0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x68, 0x02, 0x31, 0x8c, 0x18, 
-	0x1c, 0x00, 0x08, 0x82, 0xc1, 0x44, 0x0b, 0x77, 0x20, 0x07, 0xb1, 
-	0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 
-	0xa3, 0x09, 0xc4, 0x30, 0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0x53, 
-	0x2e, 0xf0, 0xc1, 0x1d, 0xc4, 0xc2, 0x68, 0x42, 0x00, 0x8c, 0x26, 
-	0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x26, 0x10, 0x83, 0x39, 0x91, 
-	0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0, 0xf2, 0x85, 0x51, 
-	0x50, 0xa2, 0xc0, 0x8c, 0x00, 0x3a, 0x06, 0x51, 0xf2, 0x19, 0x31, 
-	0x40, 0x00, 0x10, 0x04, 0x83, 0x2a, 0x1c, 0x4c, 0x81, 0xa1, 0x02, 
-	0x0b, 0x10, 0xe8, 0x98, 0x74, 0xc9, 0x67, 0xc4, 0x00, 0x01, 0x40, 
-	0x10, 0x0c, 0x2a, 0x72, 0x48, 0x05, 0xe7, 0x0a, 0x2c, 0x50, 0xa0, 
-	0x63, 0x94, 0x26, 0x9f, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xa8, 
-	0xce, 0x81, 0x15, 0x20, 0x2d, 0xb0, 0x80, 0x81, 0xce, 0x88, 0x41, 
-	0x02, 0x80, 0x20, 0x18, 0x28, 0xed, 0xf0, 0x0b, 0xe6, 0x60, 0x0e, 
-	0xba, 0xa0, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd2, 0x0e, 
-	0xbf, 0x60, 0x0e, 0xe6, 0x80, 0x0b, 0xc7, 0x88, 0x41, 0x02, 0x80, 
-	0x20, 0x18, 0x28, 0xed, 0xf0, 0x0b, 0xe6, 0x60, 0x0e, 0xb9, 0x40, 
-	0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd2, 0x0e, 0xbf, 0x60, 
-	0x0e, 0xe6, 0x50, 0x0b, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 
-	0x28, 0xed, 0xf0, 0x0b, 0xe7, 0x60, 0x0e, 0xba, 0x80, 0x07, 0x23, 
-	0x06, 0x09, 0x00, 0x82, 0x60, 0xa0, 0xb4, 0xc3, 0x2f, 0x9c, 0x83, 
-	0x39, 0xe0, 0xc2, 0x1d, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 
-	0xd2, 0x0e, 0xbf, 0x10, 0x0e, 0xe6, 0xa0, 0x0b, 0x7a, 0x30, 0x62, 
-	0x90, 0x00, 0x20, 0x08, 0x06, 0x4a, 0x3b, 0xfc, 0x42, 0x38, 0x98, 
-	0x03, 0x2e, 0xe4, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 
-	0xed, 0xf0, 0x0b, 0xe2, 0x60, 0x0e, 0xba, 0xc0, 0x07, 0x23, 0x06, 
-	0x09, 0x00, 0x82, 0x60, 0xa0, 0xb4, 0xc3, 0x2f, 0x88, 0x83, 0x39, 
-	0xe0, 0xc2, 0x1e, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd2, 
-	0x0e, 0xbf, 0x00, 0x0e, 0xe6, 0xa0, 0x0b, 0x7d, 0x30, 0x62, 0x90, 
-	0x00, 0x20, 0x08, 0x06, 0x4a, 0x3b, 0xfc, 0xc2, 0x2f, 0x98, 0x83, 
-	0x2e, 0xf8, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xed, 
-	0xf0, 0x0b, 0xe4, 0x60, 0x0e, 0xba, 0x20, 0x0a, 0x23, 0x06, 0x09, 
-	0x00, 0x82, 0x60, 0xa0, 0xb4, 0xc3, 0x2f, 0x90, 0x83, 0x39, 0xe0, 
-	0x42, 0x28, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd2, 0x0e, 
-	0xbf, 0x40, 0x0e, 0xe6, 0x90, 0x0b, 0xa0, 0x30, 0x62, 0x90, 0x00, 
-	0x20, 0x08, 0x06, 0x4a, 0x3b, 0xfc, 0x02, 0x39, 0x98, 0x43, 0x2d, 
-	0xfc, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x30, 0xec, 0xf0, 
-	0x0b, 0xbd, 0x60, 0x0e, 0xba, 0x30, 0x0a, 0x23, 0x06, 0x09, 0x00, 
-	0x82, 0x60, 0xa0, 0xb4, 0xc3, 0x2f, 0xf0, 0x82, 0x39, 0xe8, 0xc2, 
-	0x29, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd2, 0x0e, 0xbf, 
-	0xc0, 0x0b, 0xe6, 0x80, 0x0b, 0xa6, 0x30, 0x62, 0x90, 0x00, 0x20, 
-	0x08, 0x06, 0x4a, 0x3b, 0xfc, 0x02, 0x2f, 0x98, 0x43, 0x2e, 0x94, 
-	0xc2, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xed, 0xf0, 0x0b, 
-	0xbc, 0x60, 0x0e, 0xb5, 0x40, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 
-	0x00
-};
-
-unsigned int g_quad_vs_length = 6260;
@@ -1,10 +0,0 @@
-#pragma once
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-	extern unsigned char g_quad_vs[6260];
-	extern unsigned int g_quad_vs_length;
-#ifdef __cplusplus
-}
-#endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+// Text runs expanded on the GPU: the CPU uploads one text_run and the raw characters per draw_text call,
+// each thread group walks one run and writes a glyph quad (shape_instance, type 5) per character. Pen
+// positions are summed from the advances in groupshared memory, 64 characters at a time, in the same
+// order c_renderer::draw_text adds them so both paths round to the same pixels.
+
+// matches fgui::glyph_entry, glyphs_per_font entries per font handle
+struct glyph_entry
+{
+    float4 uv;      // u0, v0, u1, v1 in the font's atlas
+    float2 offset;  // pen to bitmap origin, pixels
+    float advance;  // 0 for characters the atlas doesn't have
+    uint size;      // bitmap width | height << 16, pixels
+};
+
+// matches fgui::gpu_text_run
+struct text_run
+{
+    float2 pos;
+    float4 clr;
+    uint first_char; // into chars, also the first instance written
+    uint char_count;
+    uint font;
+};
+
+// matches fgui::shape_instance (60 byte stride)
+struct shape_instance
+{
+    float2 pos;
+    float2 size;
+    float rotation;
+    float stroke_width;
+    float4 clr;
+    uint shape_type;
+    float4 uv;
+};
+
+cbuffer ExpandCB : register(b0)
+{
+    uint run_base;        // dispatches are split at 65535 groups
+    uint glyphs_per_font;
+};
+
+StructuredBuffer<glyph_entry> glyphs : register(t0);
+StructuredBuffer<text_run> runs : register(t1);
+ByteAddressBuffer chars : register(t2); // one byte per character, packed four to a word
+RWStructuredBuffer<shape_instance> instances : register(u0);
+
+#define GROUP_SIZE 64
+
+groupshared float advances[GROUP_SIZE];
+
+[numthreads(GROUP_SIZE, 1, 1)]
+void main(uint3 group_id : SV_GroupID, uint thread : SV_GroupIndex)
+{
+    text_run run = runs[run_base + group_id.x];
+    precise float run_pen = run.pos.x; // pen after the chunks before this one
+
+    for (uint chunk = 0; chunk < run.char_count; chunk += GROUP_SIZE)
+    {
+        uint i = chunk + thread;
+        bool live = i < run.char_count;
+
+        glyph_entry g = (glyph_entry)0;
+        if (live)
+        {
+            uint index = run.first_char + i;
+            uint c = (chars.Load(index & ~3u) >> ((index & 3u) * 8u)) & 0xffu;
+            if (c < glyphs_per_font)
+                g = glyphs[run.font * glyphs_per_font + c];
+        }
+
+        advances[thread] = g.advance;
+        GroupMemoryBarrierWithGroupSync();
+
+        // a serial sum rather than a scan, float addition isn't associative and a different order
+        // can move a glyph by a pixel against the CPU path. At most 64 adds per thread
+        precise float pen = run_pen;
+        for (uint j = 0; j < thread; ++j)
+            pen += advances[j];
+
+        if (live)
+        {
+            // same placement as c_renderer::draw_text, the glyph origin is rounded to whole pixels
+            precise float2 origin = float2(pen, run.pos.y) + g.offset;
+
+            shape_instance inst;
+            inst.pos = floor(origin + 0.5f);
+            inst.size = float2(g.size & 0xffffu, g.size >> 16);
+            inst.rotation = 0.0f;
+            inst.stroke_width = 1.0f;
+            inst.clr = run.clr;
+            inst.shape_type = 5;
+            inst.uv = g.uv;
+
+            instances[run.first_char + i] = inst;
+        }
+
+        for (uint k = 0; k < GROUP_SIZE; ++k)
+            run_pen += advances[k];
+        GroupMemoryBarrierWithGroupSync();
+    }
+}
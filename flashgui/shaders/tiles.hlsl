@@ -0,0 +1,300 @@
+// Tile path for frames with very many small shapes: instead of one quad per instance, bin_main sorts the
+// instances into 16x16 pixel tiles and shade_main runs one thread per pixel over its tile's list, blending in
+// submission order into a packed RGBA8 buffer. composite_vs/composite_ps then put that buffer over the render
+// target with the same premultiplied blending the quads use. Only the shape types of bucket 0 are handled
+// (boxes, outlines, circles, lines, triangles), the CPU side keeps everything else on the quad path.
+//
+// Coverage comes from pixel.hlsl's SDFs, fwidth() is replaced by the screen space gradient of each distance.
+#define main pixel_main
+#include "pixel.hlsl"
+#undef main
+
+// matches fgui::shape_instance, structured buffers are tightly packed (60 byte stride)
+struct shape_instance
+{
+    float2 pos;
+    float2 size;
+    float rotation;
+    float stroke_width;
+    float4 clr;
+    uint shape_type;
+    float4 uv;
+};
+
+#define TILE_SIZE 16                         // fgui::tile_size
+#define TILE_THREADS (TILE_SIZE * TILE_SIZE) // also fgui::tile_capacity, a full list sorts with one entry per thread
+
+cbuffer TileCB : register(b0)
+{
+    uint instance_count;
+    uint tiles_x;
+    uint tiles_y;
+    uint tile_capacity;
+    uint width;  // render target, also the row pitch of pixels
+    uint height;
+};
+
+// t0 is pixel.hlsl's font_tex, unused here
+StructuredBuffer<shape_instance> instances : register(t1);
+StructuredBuffer<uint> composite_pixels : register(t2);
+
+RWStructuredBuffer<uint> tile_counts : register(u0); // zero between passes, shade_main resets its own tile
+RWStructuredBuffer<uint> tile_lists : register(u1);  // tile_capacity entries per tile
+RWStructuredBuffer<uint> pixels : register(u2);      // premultiplied RGBA8, one per render target pixel
+
+// same as vertex.hlsl's line_aa_margin
+static const float tile_line_margin = 1.0f;
+
+// area the quad path rasterizes for the instance (vertex.hlsl's geometry), x0 y0 x1 y1
+float4 instance_bounds(shape_instance inst)
+{
+    if (inst.shape_type == 4)
+    {
+        float pad = inst.stroke_width * 0.5f + tile_line_margin;
+        return float4(min(inst.pos, inst.size) - pad, max(inst.pos, inst.size) + pad);
+    }
+    if (inst.shape_type == 6)
+    {
+        float2 p1 = inst.uv.xy, p2 = inst.uv.zw, p3 = float2(inst.rotation, inst.stroke_width);
+        return float4(min(p1, min(p2, p3)), max(p1, max(p2, p3)));
+    }
+    if (inst.shape_type == 2 || inst.shape_type == 3)
+    {
+        float radius = 0.5f * inst.size.x;
+        float2 center = inst.pos + 0.5f * inst.size;
+        return float4(center - abs(radius), center + abs(radius));
+    }
+    return float4(min(inst.pos, inst.pos + inst.size), max(inst.pos, inst.pos + inst.size));
+}
+
+// inclusive tile range holding the bounds' pixel centers, empty (first > last) when off screen
+void tile_range(float4 bounds, out int2 first, out int2 last)
+{
+    first = max(int2(floor(bounds.xy / TILE_SIZE)), 0);
+    last = min(int2(floor(bounds.zw / TILE_SIZE)), int2(tiles_x, tiles_y) - 1);
+}
+
+// fwidth() of a distance whose gradient points along dir
+float aa_width(float2 dir)
+{
+    float len = length(dir);
+    return len > 0.0f ? (abs(dir.x) + abs(dir.y)) / len : 1.0f;
+}
+
+// premultiplied color of one instance at pixel center p, what pixel.hlsl returns for that pixel
+float4 shade_instance(shape_instance inst, float2 p)
+{
+    float2 local = p - inst.pos;
+    float alpha;
+
+    if (inst.shape_type == 2 || inst.shape_type == 3)
+    {
+        float2 center = 0.5f * inst.size;
+        float2 d = local - center;
+        float aa = aa_width(d);
+
+        alpha = smoothstep(0.0, aa, -sd_circle(d, center.x));
+        if (inst.shape_type == 3)
+            alpha -= smoothstep(0.0, aa, -sd_circle(d, center.x - inst.stroke_width));
+    }
+    else if (inst.shape_type == 4)
+    {
+        float2 pa = p - inst.pos, ba = inst.size - inst.pos;
+        float ba_dot = dot(ba, ba);
+        float h = ba_dot > 0.0 ? saturate(dot(pa, ba) / ba_dot) : 0.0;
+
+        float dist = sd_line(p, inst.pos, inst.size, inst.stroke_width);
+        alpha = smoothstep(0.0, aa_width(pa - ba * h), -dist);
+    }
+    else if (inst.shape_type == 6)
+    {
+        float2 p1 = inst.uv.xy, p2 = inst.uv.zw, p3 = float2(inst.rotation, inst.stroke_width);
+        float3 bc = barycentric_coords(p1, p2, p3, p);
+        float edge_dist = min(bc.x, min(bc.y, bc.z));
+
+        // barycentrics are linear, a one pixel step gives the same differences the 2x2 quad would
+        float3 bc_x = barycentric_coords(p1, p2, p3, p + float2(1.0f, 0.0f));
+        float3 bc_y = barycentric_coords(p1, p2, p3, p + float2(0.0f, 1.0f));
+        float aa = abs(min(bc_x.x, min(bc_x.y, bc_x.z)) - edge_dist) + abs(min(bc_y.x, min(bc_y.y, bc_y.z)) - edge_dist);
+
+        alpha = smoothstep(0.0, aa, edge_dist);
+    }
+    else
+    {
+        // the quad itself, outlines fade out past its edge but the rasterizer stops there
+        if (any(local < 0.0f) || any(local >= inst.size))
+            return 0.0f;
+
+        if (inst.shape_type == 0)
+        {
+            alpha = smoothstep(0.0, 1.0f, sd_box(local, inst.size));
+        }
+        else if (inst.shape_type == 1)
+        {
+            float2 half_size = inst.size * 0.5;
+            float2 d = abs(local - half_size) - half_size;
+            float dist = length(max(d, 0.0)) + min(max(d.x, d.y), 0.0);
+            float edge = inst.stroke_width * 0.5;
+            alpha = 1.0f - smoothstep(edge, edge + aa_width(max(d, 0.0f)), abs(dist));
+        }
+        else
+        {
+            // no branch in pixel.hlsl either, the instance color as is
+            return inst.clr;
+        }
+    }
+
+    float a = inst.clr.a * alpha;
+    return float4(inst.clr.rgb * a, a);
+}
+
+uint pack_rgba8(float4 c)
+{
+    uint4 u = uint4(round(saturate(c) * 255.0f));
+    return u.r | (u.g << 8) | (u.b << 16) | (u.a << 24);
+}
+
+float4 unpack_rgba8(uint c)
+{
+    return float4(c & 0xffu, (c >> 8) & 0xffu, (c >> 16) & 0xffu, c >> 24) / 255.0f;
+}
+
+// one thread per instance, appended to every tile its bounds touch
+[numthreads(64, 1, 1)]
+void bin_main(uint3 id : SV_DispatchThreadID)
+{
+    if (id.x >= instance_count)
+        return;
+
+    int2 first, last;
+    tile_range(instance_bounds(instances[id.x]), first, last);
+
+    for (int y = first.y; y <= last.y; ++y)
+    {
+        for (int x = first.x; x <= last.x; ++x)
+        {
+            uint tile = uint(y) * tiles_x + uint(x);
+            uint slot;
+            InterlockedAdd(tile_counts[tile], 1, slot);
+            if (slot < tile_capacity)
+                tile_lists[tile * tile_capacity + slot] = id.x;
+        }
+    }
+}
+
+groupshared uint tile_ids[TILE_THREADS];
+groupshared uint tile_scan[TILE_THREADS];
+groupshared uint tile_total;
+
+// one group per tile, one thread per pixel
+[numthreads(TILE_SIZE, TILE_SIZE, 1)]
+void shade_main(uint3 group : SV_GroupID, uint3 thread : SV_GroupThreadID, uint index : SV_GroupIndex)
+{
+    uint tile = group.y * tiles_x + group.x;
+    uint2 pixel = group.xy * TILE_SIZE + thread.xy;
+    float2 p = float2(pixel) + 0.5f;
+    float4 color = 0.0f;
+
+    if (index == 0)
+    {
+        tile_total = tile_counts[tile];
+        tile_counts[tile] = 0; // ready for the next flush's bin_main
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    uint count = tile_total;
+
+    if (count == 0)
+    {
+        // nothing here, the tile stays transparent
+    }
+    else if (count <= tile_capacity)
+    {
+        // the atomics appended in any order, a bitonic sort puts the list back in submission order.
+        // unused slots sort to the end
+        tile_ids[index] = index < count ? tile_lists[tile * tile_capacity + index] : 0xffffffffu;
+        GroupMemoryBarrierWithGroupSync();
+
+        for (uint k = 2; k <= TILE_THREADS; k <<= 1)
+        {
+            for (uint j = k >> 1; j > 0; j >>= 1)
+            {
+                uint partner = index ^ j;
+                uint a = tile_ids[index];
+                uint b = tile_ids[partner];
+                bool keep_min = ((index & k) == 0) == (index < partner);
+                GroupMemoryBarrierWithGroupSync();
+
+                tile_ids[index] = keep_min ? min(a, b) : max(a, b);
+                GroupMemoryBarrierWithGroupSync();
+            }
+        }
+
+        for (uint i = 0; i < count; ++i)
+        {
+            float4 src = shade_instance(instances[tile_ids[i]], p);
+            color = src + color * (1.0f - src.a);
+        }
+    }
+    else
+    {
+        // more than the list holds: walk every instance in order and keep the ones touching this tile,
+        // TILE_THREADS at a time, compacted with a prefix sum so the order survives
+        for (uint base = 0; base < instance_count; base += TILE_THREADS)
+        {
+            uint i = base + index;
+            uint hit = 0;
+            if (i < instance_count)
+            {
+                int2 first, last;
+                tile_range(instance_bounds(instances[i]), first, last);
+                hit = all(int2(group.xy) >= first) && all(int2(group.xy) <= last) ? 1 : 0;
+            }
+
+            tile_scan[index] = hit;
+            GroupMemoryBarrierWithGroupSync();
+
+            for (uint offset = 1; offset < TILE_THREADS; offset <<= 1)
+            {
+                uint add = index >= offset ? tile_scan[index - offset] : 0;
+                GroupMemoryBarrierWithGroupSync();
+                tile_scan[index] += add;
+                GroupMemoryBarrierWithGroupSync();
+            }
+
+            if (hit)
+                tile_ids[tile_scan[index] - 1] = i;
+            GroupMemoryBarrierWithGroupSync();
+
+            uint hits = tile_scan[TILE_THREADS - 1];
+            for (uint h = 0; h < hits; ++h)
+            {
+                float4 src = shade_instance(instances[tile_ids[h]], p);
+                color = src + color * (1.0f - src.a);
+            }
+            GroupMemoryBarrierWithGroupSync();
+        }
+    }
+
+    if (pixel.x < width && pixel.y < height)
+        pixels[pixel.y * width + pixel.x] = pack_rgba8(color);
+}
+
+// one triangle over the whole viewport
+float4 composite_vs(uint vertex_id : SV_VertexID) : SV_POSITION
+{
+    float2 uv = float2((vertex_id << 1) & 2, vertex_id & 2);
+    return float4(uv * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);
+}
+
+float4 composite_ps(float4 sv_position : SV_POSITION) : SV_TARGET
+{
+    uint2 pixel = uint2(sv_position.xy);
+    uint c = composite_pixels[pixel.y * width + pixel.x];
+
+    // nothing was drawn here, leave the target alone
+    if (c == 0)
+        discard;
+
+    return unpack_rgba8(c);
+}
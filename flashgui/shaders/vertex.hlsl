@@ -4,6 +4,16 @@ cbuffer TransformCB : register(b0)
     float4x4 projection_matrix;
 };
 
+cbuffer LatchCB : register(b2)
+{
+    // where the cursor is right before the frame is executed minus where it was when the frame was built,
+    // written by s_dxgicontext::latch_cursor
+    float2 cursor_offset;
+};
+
+// shape type bit of instances that follow the cursor, fgui::cursor_relative_flag
+#define CURSOR_RELATIVE 0x80000000u
+
 // Input from the IA / vertex buffer / instancing data
 struct VS_INPUT
 {
@@ -31,19 +41,100 @@ struct VS_OUTPUT
     float4 inst_uv : TEXCOORD7; // UV rectangle for text / texture sampling
 };
 
+// Extra pixels around lines, their SDF fades out over fwidth() right at the stroke edge
+static const float line_aa_margin = 1.0f;
+
+// Oriented quad along a line segment: x runs from start to end (plus round caps), y across the stroke.
+// inst_pos = start, inst_size = end, the pixel shader works from those and sv_position only
+float2 line_corner(float2 quad_pos, float2 start, float2 end, float stroke)
+{
+    float2 ba = end - start;
+    float len = length(ba);
+    float2 dir = len > 0.0f ? ba / len : float2(1.0f, 0.0f);
+    float2 normal = float2(-dir.y, dir.x); // same winding as the unit quad
+
+    float half_width = stroke * 0.5f + line_aa_margin;
+    float along = lerp(-half_width, len + half_width, quad_pos.x);
+    float across = lerp(-half_width, half_width, quad_pos.y);
+
+    return start + dir * along + normal * across;
+}
+
+// The triangle itself: corners 0,1,2 are p1,p2,p3 and corner 3 collapses onto p3, so the second half of
+// the quad (0,2,3) has no area. p1 in inst_uv.xy, p2 in inst_uv.zw, p3 in inst_rot/inst_stroke
+float2 triangle_corner(float2 quad_pos, float4 uv, float rot, float stroke)
+{
+    float2 p1 = uv.xy;
+    float2 p2 = uv.zw;
+    float2 p3 = float2(rot, stroke);
+
+    // the pipeline culls back faces, flip the triangle into the unit quad's winding
+    float2 e1 = p2 - p1, e2 = p3 - p1;
+    if (e1.x * e2.y - e1.y * e2.x < 0.0f)
+    {
+        float2 t = p2;
+        p2 = p3;
+        p3 = t;
+    }
+
+    if (quad_pos.y < 0.5f)
+        return quad_pos.x < 0.5f ? p1 : p2;
+    return p3;
+}
+
 VS_OUTPUT main(VS_INPUT input)
 {
     VS_OUTPUT output;
 
+    // cursor following instances move by the latched offset, every point they carry does
+    if (input.inst_type & CURSOR_RELATIVE)
+    {
+        input.inst_type &= ~CURSOR_RELATIVE;
+        input.inst_pos += cursor_offset;
+
+        if (input.inst_type == 4)
+        {
+            input.inst_size += cursor_offset; // line end point
+        }
+        else if (input.inst_type == 6)
+        {
+            input.inst_uv += cursor_offset.xyxy; // p1, p2
+            input.inst_rot += cursor_offset.x;   // p3
+            input.inst_stroke += cursor_offset.y;
+        }
+    }
+
 	// Convert [0,1]x[0,1] quad_pos to local pixel offset within the instance
     float2 local = input.quad_pos * input.inst_size;
 
 	// Compute world / screen position of this corner
     float2 world_pos = input.inst_pos + local;
 
+    // quad_pos the pixel shader sees, differs from the corner when the geometry isn't the instance rect
+    float2 shade_pos = input.quad_pos;
+
+    if (input.inst_type == 4)
+    {
+        // Lines: inst_size is the end point, not an extent
+        world_pos = line_corner(input.quad_pos, input.inst_pos, input.inst_size, input.inst_stroke);
+    }
+    else if (input.inst_type == 6)
+    {
+        // Filled triangles: the triangle instead of its bounding box
+        world_pos = triangle_corner(input.quad_pos, input.inst_uv, input.inst_rot, input.inst_stroke);
+    }
+    else if (input.inst_type == 2 || input.inst_type == 3)
+    {
+        // Circles: the pixel shader's radius is half the width, bound that square around the center and
+        // skip the rotation (it doesn't change a circle). Same as the instance rect when width == height
+        float radius = 0.5f * input.inst_size.x;
+        float2 center = input.inst_pos + 0.5f * input.inst_size;
+        world_pos = center + (input.quad_pos * 2.0f - 1.0f) * radius;
+        shade_pos = (world_pos - input.inst_pos) / max(input.inst_size, 1e-6f);
+    }
 	// Optional in-place rotation about the instance center for shapes like quads
 	// Only applied when explicitly requested and for types that should rotate (e.g., not raw lines)
-    if (input.inst_rot != 0.0f && input.inst_type >= 2) // circles, boxes, etc.
+    else if (input.inst_rot != 0.0f && input.inst_type >= 2) // text, images, etc.
     {
 		// Center of the instance in screen space
         float2 center = input.inst_pos + 0.5f * input.inst_size;
@@ -69,7 +160,7 @@ VS_OUTPUT main(VS_INPUT input)
     output.sv_position = mul(projection_matrix, pos);
 
 	// Pass all per-instance data to the pixel shader for SDF / text / etc.
-    output.quad_pos = input.quad_pos; // [0,0] to [1,1]
+    output.quad_pos = shade_pos; // [0,0] to [1,1] across the instance rect
     output.inst_pos = input.inst_pos; // instance origin in screen space
     output.inst_size = input.inst_size; // full width/height
     output.inst_rot = input.inst_rot; // radians
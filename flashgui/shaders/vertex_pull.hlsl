@@ -0,0 +1,49 @@
+// Vertex pulling variant of vertex.hlsl: no vertex or index buffer and no input layout. Quad corners come
+// from SV_VertexID, instances are read from a root SRV, everything after that is vertex.hlsl's main.
+#define main quad_main
+#include "vertex.hlsl"
+#undef main
+
+// matches fgui::shape_instance, structured buffers are tightly packed (60 byte stride)
+struct shape_instance
+{
+    float2 pos;
+    float2 size;
+    float rotation;
+    float stroke_width;
+    float4 clr;
+    uint shape_type;
+    float4 uv;
+};
+
+StructuredBuffer<shape_instance> instances : register(t0, space1);
+
+cbuffer DrawCB : register(b1)
+{
+    // SV_InstanceID restarts at 0 for every draw, StartInstanceLocation is not added to it
+    uint instance_base;
+};
+
+// two triangles, same winding as quad_indices { 0, 1, 2, 0, 2, 3 }
+static const float2 corners[6] =
+{
+    float2(0.0f, 0.0f), float2(1.0f, 0.0f), float2(1.0f, 1.0f),
+    float2(0.0f, 0.0f), float2(1.0f, 1.0f), float2(0.0f, 1.0f)
+};
+
+VS_OUTPUT main(uint vertex_id : SV_VertexID, uint instance_id : SV_InstanceID)
+{
+    shape_instance inst = instances[instance_base + instance_id];
+
+    VS_INPUT input;
+    input.quad_pos = corners[vertex_id];
+    input.inst_pos = inst.pos;
+    input.inst_size = inst.size;
+    input.inst_rot = inst.rotation;
+    input.inst_stroke = inst.stroke_width;
+    input.inst_clr = inst.clr;
+    input.inst_type = inst.shape_type;
+    input.inst_uv = inst.uv;
+
+    return quad_main(input);
+}
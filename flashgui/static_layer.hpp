@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "frame_packet.hpp"
+
+namespace fgui {
+	using layer_handle = uint32_t;
+
+	// Draws that rarely change (frames, backgrounds, legends). Recorded once into bundles that read their
+	// instances from a default heap buffer, every frame after that is one ExecuteBundle per clip run.
+	struct static_layer {
+		struct segment {
+			uint32_t clip; // index into packet.clips or packet_draw::no_clip (the caller's scissor)
+			ComPtr<ID3D12GraphicsCommandList> bundle;
+		};
+
+		frame_packet packet; // CPU copy, bundles are rebuilt from it without the caller re-recording
+		bool valid = false;  // recorded since the last invalidate
+
+		// GPU side, owned by s_dxgicontext
+		bool uploaded = false; // instances buffer matches packet
+		ComPtr<ID3D12Resource> instances;
+		size_t capacity = 0;
+		D3D12_RESOURCE_STATES instances_state = D3D12_RESOURCE_STATE_COMMON;
+		uint64_t state_frame = 0; // frame_number instances_state was set in, older means it decayed to COMMON
+
+		ComPtr<ID3D12CommandAllocator> allocator; // bundle allocator, never reset, replaced with the bundles
+		std::vector<segment> segments;
+		vertex_path path = vertex_path::input_assembler; // root signature/PSO the bundles were recorded with
+		ID3D12DescriptorHeap* srv_heap = nullptr;        // bundles must set the same heap as the caller
+	};
+}
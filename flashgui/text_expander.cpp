@@ -0,0 +1,247 @@
+#include "pch.h"
+#include "text_expander.h"
+#include "dxgicontext.h"
+#include "family_batcher.h"
+#include "trace.h"
+#include <cmath>
+
+using namespace fgui;
+
+void c_text_expander::reset() {
+	m_root_sig.Reset();
+	m_pso.Reset();
+	m_glyph_table.Reset();
+	m_glyph_rows.clear();
+	m_pending_rows.clear();
+}
+
+void c_text_expander::create(s_dxgicontext& dx) {
+	reset();
+
+	// optional, draw_text stays on the CPU if it fails
+	try {
+		// b0 run base + glyphs per font, t0 glyph table, t1 runs, t2 characters, u0 glyph instances
+		m_root_sig = c_rootsig_builder(dx.device)
+			.add_constants(0, 2, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_srv(0, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_srv(1, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_srv(2, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(0, D3D12_SHADER_VISIBILITY_ALL)
+			.set_flags(D3D12_ROOT_SIGNATURE_FLAG_NONE)
+			.build("fgui_text_root_sig");
+
+		D3D12_COMPUTE_PIPELINE_STATE_DESC desc{};
+		desc.pRootSignature = m_root_sig.Get();
+		desc.CS = { dx.shaders->get_cs_text_blob()->GetBufferPointer(), dx.shaders->get_cs_text_blob()->GetBufferSize() };
+
+		m_pso = dx.pipeline_cache.get_or_create(L"fgui_pso_text_expand", desc);
+		if (!m_pso)
+			throw std::runtime_error("Failed to create compute pipeline state");
+		m_pso->SetName(L"fgui_pso_text_expand");
+
+		// 1 MB for every possible font handle, rows are filled in as fonts first show up in a run
+		CD3DX12_HEAP_PROPERTIES default_heap(D3D12_HEAP_TYPE_DEFAULT);
+		auto table_desc = CD3DX12_RESOURCE_DESC::Buffer(uint64_t(max_text_fonts) * glyphs_per_font * sizeof(glyph_entry));
+		HRESULT hr = dx.device->CreateCommittedResource(&default_heap, D3D12_HEAP_FLAG_NONE, &table_desc,
+			D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&m_glyph_table));
+		if (FAILED(hr))
+			throw std::runtime_error("Failed to create glyph table, HRESULT: " + std::to_string(hr));
+
+		m_glyph_rows.assign(max_text_fonts, 0);
+	}
+	catch (const std::exception& ex) {
+		std::string msg = "Failed to create text run pipeline: ";
+		msg += ex.what();
+		msg += "\n";
+		OutputDebugStringA(msg.c_str());
+		std::cerr << msg;
+
+		reset();
+	}
+}
+
+void c_text_expander::begin_frame() {
+	m_glyph_table_state = D3D12_RESOURCE_STATE_COMMON;
+	m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+	m_runs.clear();
+	m_chars.clear();
+}
+
+void c_text_expander::frame_submitted() {
+	m_pending_rows.clear();
+}
+
+void c_text_expander::drop_frame() {
+	for (uint32_t font : m_pending_rows)
+		m_glyph_rows[font] = 0;
+	m_pending_rows.clear();
+
+	m_runs.clear();
+	m_chars.clear();
+}
+
+void c_text_expander::queue(const std::string& text, DirectX::XMFLOAT2 pos, font_handle font, DirectX::XMFLOAT4 clr) {
+	if (text.empty())
+		return;
+
+	m_runs.push_back({ pos, clr, static_cast<uint32_t>(m_chars.size()), static_cast<uint32_t>(text.size()), font });
+	m_chars.insert(m_chars.end(), text.begin(), text.end());
+}
+
+void c_text_expander::expand(s_dxgicontext& dx) {
+	m_draws.clear();
+	m_draws_done = 0;
+
+	if (m_runs.empty())
+		return;
+
+	FGUI_TRACE_ZONE("dx::expand_text_runs");
+
+	frame_resource& fr = dx.get_current_frame_resource();
+	auto& cmd = fr.command_list;
+
+	auto transition = [&](ID3D12Resource* resource, D3D12_RESOURCE_STATES& state, D3D12_RESOURCE_STATES to) {
+		if (state == to)
+			return;
+		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(resource, state, to);
+		cmd->ResourceBarrier(1, &barrier);
+		state = to;
+	};
+
+	constexpr D3D12_RESOURCE_STATES instance_read = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+	const uint32_t char_count = static_cast<uint32_t>(m_chars.size());
+	const size_t out_bytes = size_t(char_count) * sizeof(shape_instance);
+
+	// an earlier flush of this frame may have drawn from the old buffer, it's kept until the fence
+	if (fr.text_capacity < out_bytes) {
+		const size_t capacity = std::max<size_t>(out_bytes + out_bytes / 2, 64 * 1024);
+		fr.retire(fr.text_instances);
+		fr.text_instances = dx.create_uav_buffer(capacity, L"fgui_text_instances");
+		fr.text_capacity = capacity;
+		m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+	}
+
+	// glyph rows of fonts seen for the first time, one copy each
+	std::vector<uint32_t> new_rows;
+	for (const gpu_text_run& run : m_runs) {
+		if (!m_glyph_rows[run.font]) {
+			m_glyph_rows[run.font] = 1;
+			new_rows.push_back(run.font);
+		}
+	}
+
+	if (!new_rows.empty()) {
+		transition(m_glyph_table.Get(), m_glyph_table_state, D3D12_RESOURCE_STATE_COPY_DEST);
+
+		for (uint32_t font : new_rows) {
+			glyph_entry row[glyphs_per_font]{};
+			for (uint32_t c = 0; c < glyphs_per_font; ++c) {
+				const font_glyph_info* g = dx.fonts->get_glyph_info(static_cast<font_handle>(font), c);
+				if (!g)
+					continue;
+
+				// same 512px atlas assumption as c_renderer::draw_text
+				const uint32_t w = static_cast<uint32_t>(std::lround((g->u1 - g->u0) * 512.f));
+				const uint32_t h = static_cast<uint32_t>(std::lround((g->v1 - g->v0) * 512.f));
+				row[c] = { { g->u0, g->v0, g->u1, g->v1 }, { g->offset_x, g->offset_y }, g->advance, (w & 0xffff) | (h << 16) };
+			}
+
+			const size_t offset = fr.reserve_upload(sizeof(row));
+			memcpy(fr.upload_ptr + offset, row, sizeof(row));
+			dx.draw_stats.upload_bytes += sizeof(row);
+
+			cmd->CopyBufferRegion(m_glyph_table.Get(), uint64_t(font) * sizeof(row), fr.upload_heap.Get(), offset, sizeof(row));
+			m_pending_rows.push_back(font);
+		}
+	}
+
+	// runs sorted by font, each font's glyphs end up contiguous and draw in one call
+	m_order.resize(m_runs.size());
+	for (uint32_t i = 0; i < static_cast<uint32_t>(m_order.size()); ++i)
+		m_order[i] = i;
+	std::stable_sort(m_order.begin(), m_order.end(), [&](uint32_t a, uint32_t b) { return m_runs[a].font < m_runs[b].font; });
+
+	const size_t runs_bytes = m_runs.size() * sizeof(gpu_text_run);
+	const size_t chars_bytes = frame_resource::align_up(char_count, 4);
+
+	const size_t runs_offset = fr.reserve_upload(frame_resource::align_up(runs_bytes, 16) + chars_bytes);
+	const size_t chars_offset = runs_offset + frame_resource::align_up(runs_bytes, 16);
+
+	gpu_text_run* runs_out = reinterpret_cast<gpu_text_run*>(fr.upload_ptr + runs_offset);
+	uint8_t* chars_out = fr.upload_ptr + chars_offset;
+
+	uint32_t cursor = 0;
+	for (uint32_t i : m_order) {
+		gpu_text_run run = m_runs[i];
+		memcpy(chars_out + cursor, m_chars.data() + run.first_char, run.char_count);
+		run.first_char = cursor;
+
+		if (m_draws.empty() || m_draws.back().font != run.font)
+			m_draws.push_back({ run.font, cursor, 0 });
+		m_draws.back().count += run.char_count;
+
+		if (dx.frame_debug == debug_view::batches) {
+			const DirectX::XMFLOAT4 tint = batch_color(dx.draw_stats.batches + static_cast<uint32_t>(m_draws.size() - 1));
+			run.clr = { tint.x, tint.y, tint.z, run.clr.w };
+		}
+
+		*runs_out++ = run;
+		cursor += run.char_count;
+	}
+
+	dx.draw_stats.upload_bytes += runs_bytes + chars_bytes;
+	dx.draw_stats.instances += char_count;
+
+	// expand, one thread group per run
+	transition(m_glyph_table.Get(), m_glyph_table_state, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+	transition(fr.text_instances.Get(), m_instances_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+	cmd->SetComputeRootSignature(m_root_sig.Get());
+	cmd->SetPipelineState(m_pso.Get());
+	cmd->SetComputeRoot32BitConstant(0, glyphs_per_font, 1);
+	cmd->SetComputeRootShaderResourceView(1, m_glyph_table->GetGPUVirtualAddress());
+	cmd->SetComputeRootShaderResourceView(2, fr.upload_gpu_base + runs_offset);
+	cmd->SetComputeRootShaderResourceView(3, fr.upload_gpu_base + chars_offset);
+	cmd->SetComputeRootUnorderedAccessView(4, fr.text_instances->GetGPUVirtualAddress());
+
+	const uint32_t run_count = static_cast<uint32_t>(m_runs.size());
+	for (uint32_t base = 0; base < run_count; base += D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION) {
+		cmd->SetComputeRoot32BitConstant(0, base, 0);
+		cmd->Dispatch(std::min<uint32_t>(run_count - base, D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION), 1, 1);
+	}
+
+	transition(fr.text_instances.Get(), m_instances_state, instance_read);
+	dx.bound_pso = m_pso.Get();
+
+	m_runs.clear();
+	m_chars.clear();
+}
+
+bool c_text_expander::draw_fonts(s_dxgicontext& dx, uint32_t end_bucket) {
+	if (m_draws_done == m_draws.size() || m_draws[m_draws_done].font >= end_bucket)
+		return false;
+
+	frame_resource& fr = dx.get_current_frame_resource();
+	auto& cmd = fr.command_list;
+
+	// drawn like any other text bucket, the expanded glyphs are contiguous in font order
+	const size_t bytes = size_t(m_draws.back().start + m_draws.back().count) * sizeof(shape_instance);
+	dx.bind_instances(cmd.Get(), fr.text_instances->GetGPUVirtualAddress(), bytes);
+
+	for (; m_draws_done < m_draws.size() && m_draws[m_draws_done].font < end_bucket; ++m_draws_done) {
+		const text_draw& d = m_draws[m_draws_done];
+
+		cmd->SetGraphicsRootDescriptorTable(1, dx.fonts->get_font_srv_gpu(static_cast<font_handle>(d.font)));
+		dx.draw_stats.descriptor_binds++;
+
+		if (dx.bind_family(cmd.Get(), ps_family::text, dx.bound_pso))
+			dx.draw_stats.pso_binds++;
+		dx.draw_stats.batches++;
+
+		dx.gpu_profiler.begin_batch(dx.frame_index, cmd.Get(), d.font, d.count);
+		dx.draw_instances(cmd.Get(), d.start, d.count);
+		dx.gpu_profiler.end_batch(dx.frame_index, cmd.Get());
+	}
+
+	return true;
+}
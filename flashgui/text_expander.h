@@ -0,0 +1,70 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <DirectXMath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "fonts.h"
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	struct s_dxgicontext;
+
+	// draw_text calls expanded on the GPU by text_expand.hlsl, both layouts match its structs
+	struct glyph_entry {
+		DirectX::XMFLOAT4 uv;
+		DirectX::XMFLOAT2 offset; // pen to bitmap origin
+		float advance;            // 0 for characters the atlas doesn't have
+		uint32_t size;            // bitmap width | height << 16
+	};
+
+	struct gpu_text_run {
+		DirectX::XMFLOAT2 pos;
+		DirectX::XMFLOAT4 clr;
+		uint32_t first_char; // into the uploaded characters, also the first glyph instance
+		uint32_t char_count;
+		uint32_t font;
+	};
+
+	static_assert(sizeof(glyph_entry) == 32 && sizeof(gpu_text_run) == 36, "text_expand.hlsl reads these tightly packed");
+
+	constexpr uint32_t glyphs_per_font = 128; // c_fonts bakes ASCII into every atlas
+	constexpr uint32_t max_text_fonts = 256;  // font handles below this can use text runs
+
+	// Text runs queued by c_renderer::draw_text, expanded into glyph quads by text_expand.hlsl and drawn by
+	// flush in bucket order. The glyph table has glyphs_per_font entries per font handle, a font's row is
+	// uploaded the first time one of its runs is expanded.
+	class c_text_expander {
+	public:
+		void create(s_dxgicontext& dx); // optional, leaves the expander unavailable on failure
+		bool available() const { return m_pso != nullptr; }
+
+		void queue(const std::string& text, DirectX::XMFLOAT2 pos, font_handle font, DirectX::XMFLOAT4 clr);
+		void expand(s_dxgicontext& dx); // compute expansion of the queued runs, called by flush before its draws
+		bool draw_fonts(s_dxgicontext& dx, uint32_t end_bucket); // expanded fonts below end_bucket, true if it bound the text instances
+
+		void begin_frame(); // buffers decay to common between ExecuteCommandLists
+		void frame_submitted(); // the rows recorded this frame are uploaded for good
+		void drop_frame(); // the open list won't run, its rows are uploaded again later and its runs are dropped
+
+	private:
+		void reset();
+
+		ComPtr<ID3D12RootSignature> m_root_sig;
+		ComPtr<ID3D12PipelineState> m_pso;
+		ComPtr<ID3D12Resource> m_glyph_table;
+		std::vector<uint8_t> m_glyph_rows;    // per font handle, set once its row is recorded into a frame
+		std::vector<uint32_t> m_pending_rows; // recorded this frame, undone by drop_frame
+		D3D12_RESOURCE_STATES m_glyph_table_state = D3D12_RESOURCE_STATE_COMMON; // in the open list
+		D3D12_RESOURCE_STATES m_instances_state = D3D12_RESOURCE_STATE_COMMON;
+
+		std::vector<gpu_text_run> m_runs;
+		std::vector<uint8_t> m_chars;
+		std::vector<uint32_t> m_order; // expand scratch, runs sorted by font
+		struct text_draw { uint32_t font, start, count; };
+		std::vector<text_draw> m_draws; // one per font, draw_fonts issues them in bucket order
+		size_t m_draws_done = 0;
+	};
+}
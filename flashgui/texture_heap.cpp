@@ -0,0 +1,221 @@
+#include "pch.h"
+#include "texture_heap.h"
+
+using namespace fgui;
+
+void c_buddy_allocator::initialize(uint64_t min_block, uint32_t max_order) {
+	m_min_block = min_block;
+	m_max_order = max_order;
+
+	m_free.assign(size_t(max_order) + 1, {});
+	m_free[max_order].insert(0);
+	m_free_bytes = capacity();
+}
+
+bool c_buddy_allocator::allocate(uint64_t size, uint64_t alignment, uint64_t& offset, uint32_t& order) {
+	const uint64_t needed = std::max(size, alignment);
+
+	uint32_t want = 0;
+	while (block_size(want) < needed) {
+		if (++want > m_max_order)
+			return false;
+	}
+
+	// smallest free block that fits
+	uint32_t found = want;
+	while (found <= m_max_order && m_free[found].empty())
+		++found;
+
+	if (found > m_max_order)
+		return false;
+
+	uint64_t block = *m_free[found].begin();
+	m_free[found].erase(m_free[found].begin());
+
+	// split down, keeping the lower half and freeing the upper buddy at every level
+	while (found > want) {
+		--found;
+		m_free[found].insert(block + block_size(found));
+	}
+
+	offset = block;
+	order = want;
+	m_free_bytes -= block_size(want);
+	return true;
+}
+
+void c_buddy_allocator::free(uint64_t offset, uint32_t order) {
+	m_free_bytes += block_size(order);
+
+	// merge with the buddy for as long as it is free as well
+	while (order < m_max_order) {
+		const uint64_t buddy = offset ^ block_size(order);
+
+		auto it = m_free[order].find(buddy);
+		if (it == m_free[order].end())
+			break;
+
+		m_free[order].erase(it);
+		offset = std::min(offset, buddy);
+		++order;
+	}
+
+	m_free[order].insert(offset);
+}
+
+uint64_t c_buddy_allocator::largest_free_block() const {
+	for (uint32_t order = m_max_order + 1; order-- > 0;) {
+		if (!m_free[order].empty())
+			return block_size(order);
+	}
+	return 0;
+}
+
+void c_texture_heap::initialize(ComPtr<ID3D12Device> device) {
+	m_device = device;
+}
+
+void c_texture_heap::release() {
+	m_heaps.clear();
+	m_device.Reset();
+
+	m_committed_count = 0;
+	m_committed_bytes = 0;
+	m_small_aligned_count = 0;
+}
+
+c_texture_heap::heap_block& c_texture_heap::add_heap() {
+	heap_block block{};
+	block.buddy.initialize(min_block, max_order);
+
+	// non RT/DS textures only keeps the heap valid on resource heap tier 1 hardware
+	CD3DX12_HEAP_DESC heap_desc(block.buddy.capacity(), D3D12_HEAP_TYPE_DEFAULT,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES);
+
+	if (FAILED(m_device->CreateHeap(&heap_desc, IID_PPV_ARGS(&block.heap))))
+		throw std::runtime_error("Failed to create texture heap");
+
+	m_heaps.push_back(std::move(block));
+	return m_heaps.back();
+}
+
+ComPtr<ID3D12Resource> c_texture_heap::create_texture(D3D12_RESOURCE_DESC desc, D3D12_RESOURCE_STATES initial_state, texture_allocation& out,
+	const D3D12_CLEAR_VALUE* clear_value) {
+	if (!m_device)
+		throw std::runtime_error("Texture heap not initialized");
+
+	out = {};
+
+	// ask for 4KB placement first, the runtime answers with 64KB when the texture doesn't qualify
+	desc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+	D3D12_RESOURCE_ALLOCATION_INFO info = m_device->GetResourceAllocationInfo(0, 1, &desc);
+
+	if (info.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT) {
+		desc.Alignment = 0;
+		info = m_device->GetResourceAllocationInfo(0, 1, &desc);
+	}
+
+	ComPtr<ID3D12Resource> resource;
+	const bool render_target = (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0;
+
+	if (!render_target && info.SizeInBytes <= min_block << max_order) {
+		heap_block* target = nullptr;
+		uint32_t heap_index = 0;
+		uint64_t offset = 0;
+		uint32_t order = 0;
+
+		for (uint32_t i = 0; i < m_heaps.size(); ++i) {
+			if (m_heaps[i].buddy.allocate(info.SizeInBytes, info.Alignment, offset, order)) {
+				target = &m_heaps[i];
+				heap_index = i;
+				break;
+			}
+		}
+
+		if (!target) {
+			target = &add_heap();
+			heap_index = static_cast<uint32_t>(m_heaps.size() - 1);
+
+			if (!target->buddy.allocate(info.SizeInBytes, info.Alignment, offset, order))
+				throw std::runtime_error("Texture does not fit an empty heap");
+		}
+
+		if (FAILED(m_device->CreatePlacedResource(target->heap.Get(), offset, &desc, initial_state, nullptr, IID_PPV_ARGS(&resource)))) {
+			target->buddy.free(offset, order);
+			throw std::runtime_error("Failed to create placed texture");
+		}
+
+		out.heap = heap_index;
+		out.offset = offset;
+		out.order = order;
+		out.size = info.SizeInBytes;
+
+		target->allocated_bytes += target->buddy.block_size(order);
+		target->requested_bytes += info.SizeInBytes;
+		target->placed_count++;
+
+		if (desc.Alignment == D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT) {
+			out.small_alignment = true;
+			m_small_aligned_count++;
+		}
+
+		return resource;
+	}
+
+	// bigger than a whole heap (not worth reserving a dedicated heap for it) or a render target
+	desc.Alignment = 0;
+	CD3DX12_HEAP_PROPERTIES default_heap(D3D12_HEAP_TYPE_DEFAULT);
+	if (FAILED(m_device->CreateCommittedResource(&default_heap, D3D12_HEAP_FLAG_NONE, &desc,
+		initial_state, clear_value, IID_PPV_ARGS(&resource))))
+		throw std::runtime_error("Failed to create committed texture");
+
+	out.heap = texture_allocation::committed;
+	out.size = info.SizeInBytes;
+
+	m_committed_count++;
+	m_committed_bytes += info.SizeInBytes;
+
+	return resource;
+}
+
+void c_texture_heap::free(const texture_allocation& alloc) {
+	if (alloc.heap == texture_allocation::committed) {
+		// the resource owned its memory, releasing it was enough
+		if (m_committed_count > 0) {
+			m_committed_count--;
+			m_committed_bytes -= alloc.size;
+		}
+		return;
+	}
+
+	if (alloc.heap >= m_heaps.size())
+		return;
+
+	heap_block& block = m_heaps[alloc.heap];
+	block.buddy.free(alloc.offset, alloc.order);
+	block.allocated_bytes -= block.buddy.block_size(alloc.order);
+	block.requested_bytes -= alloc.size;
+	block.placed_count--;
+
+	if (alloc.small_alignment)
+		m_small_aligned_count--;
+}
+
+texture_heap_stats c_texture_heap::get_stats() const {
+	texture_heap_stats stats{};
+
+	for (const heap_block& block : m_heaps) {
+		stats.heap_count++;
+		stats.heap_bytes += block.buddy.capacity();
+		stats.allocated_bytes += block.allocated_bytes;
+		stats.requested_bytes += block.requested_bytes;
+		stats.free_bytes += block.buddy.free_bytes();
+		stats.largest_free_block = std::max(stats.largest_free_block, block.buddy.largest_free_block());
+		stats.placed_count += block.placed_count;
+	}
+
+	stats.committed_count = m_committed_count;
+	stats.committed_bytes = m_committed_bytes;
+	stats.small_aligned_count = m_small_aligned_count;
+	return stats;
+}
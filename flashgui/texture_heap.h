@@ -0,0 +1,109 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	// Power of two buddy allocator over a range of [0, min_block << max_order).
+	// Blocks are aligned to their own size, so a block of at least the requested alignment is always aligned.
+	class c_buddy_allocator {
+	public:
+		void initialize(uint64_t min_block, uint32_t max_order);
+
+		// returns false when no block of the needed order is free
+		bool allocate(uint64_t size, uint64_t alignment, uint64_t& offset, uint32_t& order);
+		void free(uint64_t offset, uint32_t order);
+
+		uint64_t block_size(uint32_t order) const { return m_min_block << order; }
+		uint64_t capacity() const { return block_size(m_max_order); }
+		uint64_t free_bytes() const { return m_free_bytes; }
+		uint64_t largest_free_block() const;
+		bool empty() const { return m_free_bytes == capacity(); }
+
+	private:
+		uint64_t m_min_block = 0;
+		uint32_t m_max_order = 0;
+		uint64_t m_free_bytes = 0;
+
+		// free block offsets per order, ordered so buddies can be found and merged quickly
+		std::vector<std::set<uint64_t>> m_free;
+	};
+
+	// where a texture's memory came from, needed to give it back
+	struct texture_allocation {
+		static constexpr uint32_t committed = UINT32_MAX;
+
+		uint32_t heap = committed; // index into the heap list, or committed for a standalone resource
+		uint64_t offset = 0;
+		uint32_t order = 0;
+		uint64_t size = 0; // bytes the resource actually needs
+		bool small_alignment = false; // placed at 4KB instead of 64KB alignment
+	};
+
+	struct texture_heap_stats {
+		uint32_t heap_count = 0;
+		uint64_t heap_bytes = 0;      // total reserved in ID3D12Heaps
+		uint64_t allocated_bytes = 0; // buddy blocks handed out
+		uint64_t requested_bytes = 0; // what the placed resources asked for
+		uint64_t free_bytes = 0;
+		uint64_t largest_free_block = 0;
+		uint32_t placed_count = 0;
+		uint32_t committed_count = 0; // textures too big for a heap
+		uint64_t committed_bytes = 0;
+		uint32_t small_aligned_count = 0; // placed with 4KB instead of 64KB alignment
+
+		// 0 = all free memory is one block, close to 1 = free memory is scattered in small pieces
+		float fragmentation() const {
+			return free_bytes ? 1.f - float(double(largest_free_block) / double(free_bytes)) : 0.f;
+		}
+
+		// share of allocated block memory lost to power of two rounding
+		float internal_waste() const {
+			return allocated_bytes ? 1.f - float(double(requested_bytes) / double(allocated_bytes)) : 0.f;
+		}
+	};
+
+	// Places textures into large default heaps instead of creating a committed resource each.
+	// Small textures get 4KB placement alignment where the device allows it, anything larger
+	// than a whole heap falls back to a committed resource.
+	class c_texture_heap {
+	public:
+		static constexpr uint64_t min_block = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT; // 4KB
+		static constexpr uint32_t max_order = 13; // 4KB << 13 = 32MB per heap
+
+		void initialize(ComPtr<ID3D12Device> device);
+		void release();
+
+		// create a texture in initial_state and record where its memory lives. Render targets are always committed,
+		// the heaps only take non RT/DS textures
+		ComPtr<ID3D12Resource> create_texture(D3D12_RESOURCE_DESC desc, D3D12_RESOURCE_STATES initial_state, texture_allocation& out,
+			const D3D12_CLEAR_VALUE* clear_value = nullptr);
+
+		// return memory after the resource itself has been released and the GPU is done with it
+		void free(const texture_allocation& alloc);
+
+		texture_heap_stats get_stats() const;
+
+	private:
+		struct heap_block {
+			ComPtr<ID3D12Heap> heap;
+			c_buddy_allocator buddy;
+			uint64_t allocated_bytes = 0;
+			uint64_t requested_bytes = 0;
+			uint32_t placed_count = 0;
+		};
+
+		heap_block& add_heap();
+
+		ComPtr<ID3D12Device> m_device;
+		std::vector<heap_block> m_heaps;
+
+		uint32_t m_committed_count = 0;
+		uint64_t m_committed_bytes = 0;
+		uint32_t m_small_aligned_count = 0;
+	};
+}
@@ -0,0 +1,224 @@
+#include "pch.h"
+#include "tile_binner.h"
+#include "dxgicontext.h"
+#include "redraw_tracker.h"
+#include "trace.h"
+#include <algorithm>
+
+using namespace fgui;
+
+namespace {
+	// below this the quads are cheap enough, the binning and compositing passes cost more than they save
+	constexpr size_t min_tile_instances = 16384;
+
+	// one bin thread per instance, a single Dispatch along x
+	constexpr size_t max_tile_instances = size_t(D3D12_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION) * 64;
+
+	// average bounds (stroke and AA fringe included) of a "small" shape, about 32x32 pixels
+	constexpr uint64_t max_mean_area = 32 * 32;
+
+	inline bool tiled_type(uint32_t shape_type) {
+		switch (shape_type) {
+		case 0: case 1: case 2: case 3: case 4: case 6: return true;
+		default: return false;
+		}
+	}
+}
+
+bool fgui::prefer_tiles(const shape_instance* instances, size_t count, uint32_t width, uint32_t height, tile_mode mode) {
+	if (mode == tile_mode::off || !count || count > max_tile_instances || !width || !height)
+		return false;
+
+	if (mode == tile_mode::automatic && count < min_tile_instances)
+		return false;
+
+	uint64_t area = 0;    // on screen pixels of all bounds
+	uint64_t entries = 0; // tile list entries bin_main will append
+
+	for (size_t i = 0; i < count; ++i) {
+		const shape_instance& inst = instances[i];
+		if (!tiled_type(inst.shape_type))
+			return false;
+
+		RECT r = c_redraw_tracker::bounds_of(inst);
+		r.left = std::max<LONG>(r.left, 0);
+		r.top = std::max<LONG>(r.top, 0);
+		r.right = std::min<LONG>(r.right, static_cast<LONG>(width));
+		r.bottom = std::min<LONG>(r.bottom, static_cast<LONG>(height));
+		if (r.right <= r.left || r.bottom <= r.top)
+			continue;
+
+		area += uint64_t(r.right - r.left) * uint64_t(r.bottom - r.top);
+		entries += uint64_t((r.right - 1) / tile_size - r.left / tile_size + 1) * uint64_t((r.bottom - 1) / tile_size - r.top / tile_size + 1);
+	}
+
+	if (mode == tile_mode::always)
+		return true;
+
+	// lists past tile_capacity rescan every instance, keep the average well below that
+	const uint64_t tiles = uint64_t((width + tile_size - 1) / tile_size) * ((height + tile_size - 1) / tile_size);
+	return area <= count * max_mean_area && entries <= tiles * tile_capacity / 2;
+}
+
+void c_tile_binner::reset() {
+	m_root_sig.Reset();
+	m_composite_root_sig.Reset();
+	m_bin_pso.Reset();
+	m_shade_pso.Reset();
+	m_composite_pso.Reset();
+}
+
+void c_tile_binner::create(s_dxgicontext& dx) {
+	reset();
+
+	// optional, bucket 0 is always drawn as quads if it fails
+	try {
+		// b0 tile constants, t1 instances, u0 tile counts, u1 tile lists, u2 pixels (see tiles.hlsl)
+		m_root_sig = c_rootsig_builder(dx.device)
+			.add_constants(0, 6, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_srv(1, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(0, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(1, D3D12_SHADER_VISIBILITY_ALL)
+			.add_root_uav(2, D3D12_SHADER_VISIBILITY_ALL)
+			.set_flags(D3D12_ROOT_SIGNATURE_FLAG_NONE)
+			.build("fgui_tile_root_sig");
+
+		// b0 for the row pitch, t2 pixels
+		m_composite_root_sig = c_rootsig_builder(dx.device)
+			.add_constants(0, 6, D3D12_SHADER_VISIBILITY_PIXEL)
+			.add_root_srv(2, D3D12_SHADER_VISIBILITY_PIXEL)
+			.set_flags(D3D12_ROOT_SIGNATURE_FLAG_NONE)
+			.build("fgui_tile_composite_root_sig");
+
+		auto create_cs = [&](ComPtr<ID3DBlob> blob, const wchar_t* name) {
+			D3D12_COMPUTE_PIPELINE_STATE_DESC desc{};
+			desc.pRootSignature = m_root_sig.Get();
+			desc.CS = { blob->GetBufferPointer(), blob->GetBufferSize() };
+
+			ComPtr<ID3D12PipelineState> pso = dx.pipeline_cache.get_or_create(name, desc);
+			if (!pso)
+				throw std::runtime_error("Failed to create compute pipeline state");
+			pso->SetName(name);
+			return pso;
+		};
+
+		m_bin_pso = create_cs(dx.shaders->get_cs_tile_bin_blob(), L"fgui_pso_tile_bin");
+		m_shade_pso = create_cs(dx.shaders->get_cs_tile_shade_blob(), L"fgui_pso_tile_shade");
+
+		// the tile buffer is premultiplied like the quads' output, blended the same way. A fullscreen triangle
+		// from SV_VertexID
+		m_composite_pso = dx.build_quad_pso(dx.shaders->get_vs_tile_composite_blob(), dx.shaders->get_ps_tile_composite_blob(),
+			m_composite_root_sig, "fgui_pso_tile_composite");
+	}
+	catch (const std::exception& ex) {
+		std::string msg = "Failed to create tile pipeline: ";
+		msg += ex.what();
+		msg += "\n";
+		OutputDebugStringA(msg.c_str());
+		std::cerr << msg;
+
+		reset();
+	}
+}
+
+void c_tile_binner::begin_frame() {
+	m_bins_state = D3D12_RESOURCE_STATE_COMMON;
+	m_pixels_state = D3D12_RESOURCE_STATE_COMMON;
+}
+
+void c_tile_binner::draw(s_dxgicontext& dx, D3D12_GPU_VIRTUAL_ADDRESS instances, uint32_t count) {
+	FGUI_TRACE_ZONE("dx::draw_tiles");
+
+	frame_resource& fr = dx.get_current_frame_resource();
+	auto& cmd = fr.command_list;
+
+	auto transition = [&](ID3D12Resource* resource, D3D12_RESOURCE_STATES& state, D3D12_RESOURCE_STATES to) {
+		if (state == to)
+			return;
+		auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(resource, state, to);
+		cmd->ResourceBarrier(1, &barrier);
+		state = to;
+	};
+
+	struct {
+		uint32_t instance_count, tiles_x, tiles_y, tile_capacity, width, height;
+	} constants;
+	constants.instance_count = count;
+	constants.width = static_cast<uint32_t>(dx.viewport.Width);
+	constants.height = static_cast<uint32_t>(dx.viewport.Height);
+	constants.tiles_x = (constants.width + tile_size - 1) / tile_size;
+	constants.tiles_y = (constants.height + tile_size - 1) / tile_size;
+	constants.tile_capacity = tile_capacity;
+
+	// counts first, then tile_capacity list entries per tile. New buffers are zeroed, which is the state
+	// shade_main leaves the counts in
+	const size_t tiles = size_t(constants.tiles_x) * constants.tiles_y;
+	const size_t counts_bytes = frame_resource::align_up(tiles * sizeof(uint32_t), 256);
+	const size_t bins_bytes = counts_bytes + tiles * tile_capacity * sizeof(uint32_t);
+	const size_t pixels_bytes = size_t(constants.width) * constants.height * sizeof(uint32_t);
+
+	// an earlier flush of this frame may use the old ones
+	if (fr.tile_bins_capacity < bins_bytes) {
+		fr.retire(fr.tile_bins);
+		fr.tile_bins = dx.create_uav_buffer(bins_bytes, L"fgui_tile_bins");
+		fr.tile_bins_capacity = bins_bytes;
+		m_bins_state = D3D12_RESOURCE_STATE_COMMON;
+	}
+	if (fr.tile_pixels_capacity < pixels_bytes) {
+		fr.retire(fr.tile_pixels);
+		fr.tile_pixels = dx.create_uav_buffer(pixels_bytes, L"fgui_tile_pixels");
+		fr.tile_pixels_capacity = pixels_bytes;
+		m_pixels_state = D3D12_RESOURCE_STATE_COMMON;
+	}
+
+	const D3D12_GPU_VIRTUAL_ADDRESS counts_va = fr.tile_bins->GetGPUVirtualAddress();
+	const D3D12_GPU_VIRTUAL_ADDRESS pixels_va = fr.tile_pixels->GetGPUVirtualAddress();
+
+	dx.gpu_profiler.begin_batch(dx.frame_index, cmd.Get(), 0, count);
+
+	// the previous flush's shade pass reset the counts, finish its writes before binning again
+	if (m_bins_state == D3D12_RESOURCE_STATE_UNORDERED_ACCESS) {
+		auto uav = CD3DX12_RESOURCE_BARRIER::UAV(fr.tile_bins.Get());
+		cmd->ResourceBarrier(1, &uav);
+	}
+	transition(fr.tile_bins.Get(), m_bins_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	transition(fr.tile_pixels.Get(), m_pixels_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+	cmd->SetComputeRootSignature(m_root_sig.Get());
+	cmd->SetComputeRoot32BitConstants(0, 6, &constants, 0);
+	cmd->SetComputeRootShaderResourceView(1, instances);
+	cmd->SetComputeRootUnorderedAccessView(2, counts_va);
+	cmd->SetComputeRootUnorderedAccessView(3, counts_va + counts_bytes);
+	cmd->SetComputeRootUnorderedAccessView(4, pixels_va);
+
+	// one thread per instance appends to the tiles it touches
+	cmd->SetPipelineState(m_bin_pso.Get());
+	cmd->Dispatch((count + 63) / 64, 1, 1);
+
+	auto uav = CD3DX12_RESOURCE_BARRIER::UAV(fr.tile_bins.Get());
+	cmd->ResourceBarrier(1, &uav);
+
+	// one group per tile, one thread per pixel
+	cmd->SetPipelineState(m_shade_pso.Get());
+	cmd->Dispatch(constants.tiles_x, constants.tiles_y, 1);
+
+	transition(fr.tile_pixels.Get(), m_pixels_state, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+	// over the render target within the current scissor, the clip of this flush
+	cmd->SetGraphicsRootSignature(m_composite_root_sig.Get());
+	cmd->SetPipelineState(m_composite_pso.Get());
+	cmd->SetGraphicsRoot32BitConstants(0, 6, &constants, 0);
+	cmd->SetGraphicsRootShaderResourceView(1, pixels_va);
+	cmd->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	cmd->DrawInstanced(3, 1, 0, 0);
+
+	dx.gpu_profiler.end_batch(dx.frame_index, cmd.Get());
+
+	// back to the quads' root signature, which drops its bindings
+	dx.bind_quad_root(cmd.Get());
+	dx.bound_pso = m_composite_pso.Get();
+
+	dx.draw_stats.tiled_instances += count;
+	dx.draw_stats.batches++;
+	dx.draw_stats.pso_binds++;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <cstdint>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	struct shape_instance;
+	struct s_dxgicontext;
+
+	// how flush draws bucket 0 (the untextured shapes): instanced quads, or binned into screen tiles and shaded
+	// by compute (tiles.hlsl), which avoids the rasterizer's cost of many tiny quads
+	enum class tile_mode {
+		automatic, // tiles for large buckets of small shapes, see prefer_tiles
+		off,
+		always     // whenever every instance is a type the tile shader handles
+	};
+
+	// screen tiles of the compute path, TILE_SIZE and TILE_THREADS in tiles.hlsl
+	constexpr uint32_t tile_size = 16;
+	constexpr uint32_t tile_capacity = tile_size * tile_size; // list entries per tile, more fall back to a full scan
+
+	// Whether a bucket is cheaper shaded per screen tile than as instanced quads. Every instance has to be a
+	// shape type tiles.hlsl handles, then automatic wants many instances that are small on average and spread
+	// thin enough that most tiles' lists fit; always only checks the types.
+	bool prefer_tiles(const shape_instance* instances, size_t count, uint32_t width, uint32_t height, tile_mode mode);
+
+	// The compute tile path: bin_main appends every instance to the tiles it touches, shade_main shades each tile
+	// into a packed pixel buffer and the composite pass blends that over the target. The buffers live in the
+	// frame resource, this holds the pipelines and the buffers' state in the open command list.
+	class c_tile_binner {
+	public:
+		void create(s_dxgicontext& dx); // optional, leaves the binner unavailable on failure
+		bool available() const { return m_shade_pso != nullptr; }
+
+		void begin_frame(); // buffers decay to common between ExecuteCommandLists
+
+		// bin, shade and composite count instances over dx's target, within its current scissor
+		void draw(s_dxgicontext& dx, D3D12_GPU_VIRTUAL_ADDRESS instances, uint32_t count);
+
+	private:
+		void reset();
+
+		ComPtr<ID3D12RootSignature> m_root_sig, m_composite_root_sig;
+		ComPtr<ID3D12PipelineState> m_bin_pso, m_shade_pso, m_composite_pso;
+		D3D12_RESOURCE_STATES m_bins_state = D3D12_RESOURCE_STATE_COMMON;
+		D3D12_RESOURCE_STATES m_pixels_state = D3D12_RESOURCE_STATE_COMMON;
+	};
+}
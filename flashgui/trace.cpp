@@ -0,0 +1,176 @@
+#include "pch.h"
+#include "trace.h"
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+
+using namespace fgui;
+
+namespace {
+	static_assert((trace::ring_capacity & (trace::ring_capacity - 1)) == 0, "ring capacity must be a power of two");
+
+	struct event {
+		const char* name;
+		int64_t start_ns;
+		int64_t end_ns;
+	};
+
+	// single writer (the owning thread), any number of readers that tolerate lost events
+	struct thread_ring {
+		event events[trace::ring_capacity];
+		std::atomic<uint64_t> head{ 0 };    // events ever written
+		std::atomic<uint64_t> cleared{ 0 }; // head at the last clear()
+		DWORD tid = 0;
+		std::string name; // guarded by the registry mutex
+	};
+
+	struct registry {
+		std::mutex mutex;
+		// rings outlive their threads so a dump after a thread exits still has its events
+		std::vector<std::unique_ptr<thread_ring>> rings;
+	};
+
+	registry& get_registry() {
+		static registry reg;
+		return reg;
+	}
+
+	thread_local thread_ring* t_ring = nullptr;
+
+	thread_ring& local_ring() {
+		if (!t_ring) {
+			auto ring = std::make_unique<thread_ring>();
+			ring->tid = GetCurrentThreadId();
+
+			registry& reg = get_registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			t_ring = ring.get();
+			reg.rings.push_back(std::move(ring));
+		}
+		return *t_ring;
+	}
+
+	void write_json_string(std::ofstream& out, const char* s) {
+		out << '"';
+		for (; s && *s; ++s) {
+			const unsigned char c = static_cast<unsigned char>(*s);
+			if (c == '"' || c == '\\') {
+				out << '\\' << *s;
+			}
+			else if (c < 0x20) {
+				char buf[8];
+				snprintf(buf, sizeof(buf), "\\u%04x", c);
+				out << buf;
+			}
+			else {
+				out << *s;
+			}
+		}
+		out << '"';
+	}
+}
+
+void trace::record(const char* name, int64_t start_ns, int64_t end_ns) {
+	thread_ring& ring = local_ring();
+
+	const uint64_t head = ring.head.load(std::memory_order_relaxed);
+	ring.events[head & (ring_capacity - 1)] = { name, start_ns, end_ns };
+	ring.head.store(head + 1, std::memory_order_release);
+}
+
+void trace::set_thread_name(const char* name) {
+	thread_ring& ring = local_ring();
+
+	std::lock_guard<std::mutex> lock(get_registry().mutex);
+	ring.name = name ? name : "";
+}
+
+void trace::clear() {
+	registry& reg = get_registry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+
+	for (auto& ring : reg.rings)
+		ring->cleared.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+bool trace::write_chrome_trace(const std::string& path) {
+	struct thread_events {
+		DWORD tid;
+		std::string name;
+		std::vector<event> events;
+	};
+
+	std::vector<thread_events> threads;
+	int64_t origin = INT64_MAX;
+
+	{
+		registry& reg = get_registry();
+		std::lock_guard<std::mutex> lock(reg.mutex);
+
+		for (auto& ring : reg.rings) {
+			const uint64_t head = ring->head.load(std::memory_order_acquire);
+			const uint64_t oldest = head > ring_capacity ? head - ring_capacity : 0;
+			const uint64_t first = std::max(oldest, ring->cleared.load(std::memory_order_relaxed));
+
+			thread_events te{ ring->tid, ring->name, {} };
+			te.events.reserve(size_t(head - first));
+
+			for (uint64_t i = first; i < head; ++i)
+				te.events.push_back(ring->events[i & (ring_capacity - 1)]);
+
+			// the owner kept writing while we copied, anything it lapped is garbage now
+			const uint64_t head_after = ring->head.load(std::memory_order_acquire);
+			const uint64_t valid_from = head_after > ring_capacity ? head_after - ring_capacity : 0;
+			if (valid_from > first)
+				te.events.erase(te.events.begin(), te.events.begin() + size_t(std::min(valid_from, head) - first));
+
+			for (const event& e : te.events)
+				origin = std::min(origin, e.start_ns);
+
+			threads.push_back(std::move(te));
+		}
+	}
+
+	std::ofstream out(path, std::ios::out | std::ios::trunc);
+	if (!out) {
+		OutputDebugStringA(("[flashgui] Failed to open trace file: " + path + "\n").c_str());
+		return false;
+	}
+
+	if (origin == INT64_MAX)
+		origin = 0;
+
+	const DWORD pid = GetCurrentProcessId();
+	bool first_event = true;
+
+	auto separator = [&]() {
+		out << (first_event ? "\n" : ",\n");
+		first_event = false;
+	};
+
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	for (const thread_events& te : threads) {
+		if (!te.name.empty()) {
+			separator();
+			out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << te.tid << ",\"args\":{\"name\":";
+			write_json_string(out, te.name.c_str());
+			out << "}}";
+		}
+
+		for (const event& e : te.events) {
+			char times[96];
+			// complete events, microseconds with ns precision
+			snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f",
+				double(e.start_ns - origin) / 1000.0, double(e.end_ns - e.start_ns) / 1000.0);
+
+			separator();
+			out << "{\"name\":";
+			write_json_string(out, e.name);
+			out << ",\"cat\":\"fgui\",\"ph\":\"X\"," << times << ",\"pid\":" << pid << ",\"tid\":" << te.tid << "}";
+		}
+	}
+
+	out << "\n]}\n";
+	return static_cast<bool>(out);
+}
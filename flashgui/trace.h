@@ -0,0 +1,60 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Scoped CPU trace zones for the hot paths. Build with FGUI_ENABLE_TRACE (CMake option of the same name)
+// to compile them in, otherwise FGUI_TRACE_ZONE expands to nothing and costs nothing.
+//
+//   void c_renderer::begin_frame() {
+//       FGUI_TRACE_ZONE("renderer::begin_frame");
+//       ...
+//
+// Zone names must outlive the trace (string literals), only the pointer is stored.
+
+#define FGUI_TRACE_CONCAT_INNER(a, b) a##b
+#define FGUI_TRACE_CONCAT(a, b) FGUI_TRACE_CONCAT_INNER(a, b)
+
+#if defined(FGUI_ENABLE_TRACE) && FGUI_ENABLE_TRACE
+#define FGUI_TRACE_ZONE(name) ::fgui::trace::c_zone FGUI_TRACE_CONCAT(fgui_trace_zone_, __LINE__)(name)
+#else
+#define FGUI_TRACE_ZONE(name) ((void)0)
+#endif
+
+namespace fgui {
+	namespace trace {
+		// events kept per thread, older ones are overwritten
+		constexpr uint32_t ring_capacity = 16384;
+
+		inline int64_t now_ns() {
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		// appends to the calling thread's ring, no locks after the thread's first event
+		void record(const char* name, int64_t start_ns, int64_t end_ns);
+
+		// shown as the thread's name in the trace viewer
+		void set_thread_name(const char* name);
+
+		// write every thread's ring as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev)
+		// safe to call while other threads keep recording, events overwritten during the copy are dropped
+		bool write_chrome_trace(const std::string& path);
+
+		// drop everything recorded so far
+		void clear();
+
+		class c_zone {
+		public:
+			explicit c_zone(const char* name) : m_name(name), m_start(now_ns()) {}
+			~c_zone() { record(m_name, m_start, now_ns()); }
+
+			c_zone(const c_zone&) = delete;
+			c_zone& operator=(const c_zone&) = delete;
+
+		private:
+			const char* m_name;
+			int64_t m_start;
+		};
+	}
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include <wrl.h>
+#include <d3d12.h>
+#include <directx/d3dx12.h>
+#include <vector>
+#include <stdexcept>
+
+using Microsoft::WRL::ComPtr;
+
+namespace fgui {
+	// Persistent staging buffer for texture uploads, with its own command list and fence so uploads
+	// never touch the frame's command list. Copies are recorded with upload() and sent with flush().
+	// The buffer is reused across uploads and grows when a single batch doesn't fit, once batches fit the
+	// initial size again for a while it shrinks back to it.
+	class c_upload_arena {
+	public:
+		struct stats {
+			size_t capacity = 0;
+			size_t peak_usage = 0; // largest single batch so far
+			uint64_t upload_count = 0;
+			uint64_t bytes_uploaded = 0;
+			uint32_t grow_count = 0;
+			uint32_t shrink_count = 0;
+		};
+
+		c_upload_arena() = default;
+		c_upload_arena(const c_upload_arena&) = delete;
+		c_upload_arena& operator=(const c_upload_arena&) = delete;
+		~c_upload_arena() { release(); }
+
+		void initialize(ComPtr<ID3D12Device> device, size_t size) {
+			m_device = device;
+
+			if (FAILED(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_allocator))))
+				throw std::runtime_error("Failed to create upload command allocator");
+
+			if (FAILED(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_allocator.Get(), nullptr, IID_PPV_ARGS(&m_cmd))))
+				throw std::runtime_error("Failed to create upload command list");
+
+			m_cmd->Close();
+
+			if (FAILED(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence))))
+				throw std::runtime_error("Failed to create upload fence");
+
+			m_fence_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+			if (!m_fence_event)
+				throw std::runtime_error("Failed to create upload fence event");
+
+			m_initial_size = size;
+			create_buffer(size);
+		}
+
+		void release() {
+			if (m_buffer && m_mapped)
+				m_buffer->Unmap(0, nullptr);
+
+			m_buffer.Reset();
+			m_mapped = nullptr;
+			m_retired.clear();
+
+			m_cmd.Reset();
+			m_allocator.Reset();
+			m_fence.Reset();
+
+			if (m_fence_event) {
+				CloseHandle(m_fence_event);
+				m_fence_event = nullptr;
+			}
+
+			m_device.Reset();
+		}
+
+		// record a copy of subs into dst and transition dst to after_state
+		void upload(ID3D12Resource* dst, UINT first_sub, UINT num_subs, const D3D12_SUBRESOURCE_DATA* subs,
+			D3D12_RESOURCE_STATES after_state) {
+
+			const UINT64 needed = GetRequiredIntermediateSize(dst, first_sub, num_subs);
+			size_t offset = align_up(m_cursor, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+			if (offset + needed > m_size) {
+				// copies already recorded still read the old buffer, keep it until the batch completes
+				if (m_open)
+					m_retired.push_back(m_buffer);
+
+				m_buffer->Unmap(0, nullptr);
+				create_buffer(std::max(size_t(needed), m_size * 2));
+				m_stats.grow_count++;
+				m_small_batches = 0;
+				offset = 0;
+			}
+
+			if (!m_open) {
+				m_allocator->Reset();
+				m_cmd->Reset(m_allocator.Get(), nullptr);
+				m_open = true;
+			}
+
+			// same layout UpdateSubresources uses, written through the persistent map instead of mapping per call
+			const D3D12_RESOURCE_DESC desc = dst->GetDesc();
+			m_layouts.resize(num_subs);
+			m_rows.resize(num_subs);
+			m_row_sizes.resize(num_subs);
+			m_device->GetCopyableFootprints(&desc, first_sub, num_subs, offset, m_layouts.data(), m_rows.data(), m_row_sizes.data(), nullptr);
+
+			for (UINT i = 0; i < num_subs; ++i) {
+				const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout = m_layouts[i];
+				D3D12_MEMCPY_DEST dest{ m_mapped + layout.Offset, layout.Footprint.RowPitch, SIZE_T(layout.Footprint.RowPitch) * m_rows[i] };
+				MemcpySubresource(&dest, &subs[i], static_cast<SIZE_T>(m_row_sizes[i]), m_rows[i], layout.Footprint.Depth);
+			}
+
+			if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+				m_cmd->CopyBufferRegion(dst, 0, m_buffer.Get(), m_layouts[0].Offset, m_layouts[0].Footprint.Width);
+			}
+			else {
+				for (UINT i = 0; i < num_subs; ++i) {
+					CD3DX12_TEXTURE_COPY_LOCATION dst_loc(dst, first_sub + i);
+					CD3DX12_TEXTURE_COPY_LOCATION src_loc(m_buffer.Get(), m_layouts[i]);
+					m_cmd->CopyTextureRegion(&dst_loc, 0, 0, 0, &src_loc, nullptr);
+				}
+			}
+
+			auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(dst, D3D12_RESOURCE_STATE_COPY_DEST, after_state);
+			m_cmd->ResourceBarrier(1, &barrier);
+
+			m_cursor = offset + size_t(needed);
+			m_batch_bytes += size_t(needed);
+
+			m_stats.upload_count++;
+			m_stats.bytes_uploaded += needed;
+		}
+
+		// submit recorded copies and wait for them, the staging memory is free again afterwards
+		void flush(ComPtr<ID3D12CommandQueue> cmd_queue) {
+			if (!m_open)
+				return;
+
+			m_cmd->Close();
+			m_open = false;
+
+			ID3D12CommandList* lists[] = { m_cmd.Get() };
+			cmd_queue->ExecuteCommandLists(1, lists);
+
+			m_fence_value++;
+			if (FAILED(cmd_queue->Signal(m_fence.Get(), m_fence_value)))
+				throw std::runtime_error("Failed to signal upload fence");
+
+			if (m_fence->GetCompletedValue() < m_fence_value) {
+				m_fence->SetEventOnCompletion(m_fence_value, m_fence_event);
+				WaitForSingleObject(m_fence_event, INFINITE);
+			}
+
+			m_stats.peak_usage = std::max(m_stats.peak_usage, m_batch_bytes);
+
+			// a one off large batch grew the buffer, it goes back to the initial size after enough batches that
+			// would have fit in it. The GPU is done with it, nothing recorded still reads it
+			if (m_size > m_initial_size) {
+				m_small_batches = m_cursor <= m_initial_size ? m_small_batches + 1 : 0;
+				if (m_small_batches >= shrink_after) {
+					m_buffer->Unmap(0, nullptr);
+					create_buffer(m_initial_size);
+					m_stats.shrink_count++;
+					m_small_batches = 0;
+				}
+			}
+
+			m_batch_bytes = 0;
+			m_cursor = 0;
+			m_retired.clear();
+		}
+
+		const stats& get_stats() const { return m_stats; }
+
+	private:
+		static size_t align_up(size_t v, size_t a) { return (v + (a - 1)) & ~(a - 1); }
+
+		static constexpr uint32_t shrink_after = 16; // batches in a row that fit the initial size
+
+		void create_buffer(size_t size) {
+			CD3DX12_HEAP_PROPERTIES heap_props(D3D12_HEAP_TYPE_UPLOAD);
+			auto desc = CD3DX12_RESOURCE_DESC::Buffer(size);
+
+			if (FAILED(m_device->CreateCommittedResource(&heap_props, D3D12_HEAP_FLAG_NONE, &desc,
+				D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_buffer))))
+				throw std::runtime_error("Failed to create staging buffer");
+
+			// upload heaps can stay mapped, upload() writes through this for every copy
+			if (FAILED(m_buffer->Map(0, nullptr, reinterpret_cast<void**>(&m_mapped))))
+				throw std::runtime_error("Failed to map staging buffer");
+
+			m_size = size;
+			m_stats.capacity = size;
+		}
+
+		ComPtr<ID3D12Device> m_device;
+		ComPtr<ID3D12CommandAllocator> m_allocator;
+		ComPtr<ID3D12GraphicsCommandList> m_cmd;
+		ComPtr<ID3D12Fence> m_fence;
+		HANDLE m_fence_event = nullptr;
+		UINT64 m_fence_value = 0;
+
+		ComPtr<ID3D12Resource> m_buffer;
+		uint8_t* m_mapped = nullptr;
+		size_t m_size = 0;
+		size_t m_initial_size = 0;
+		uint32_t m_small_batches = 0; // flushed in a row within m_initial_size while grown
+		size_t m_cursor = 0;
+		size_t m_batch_bytes = 0;
+		bool m_open = false;
+
+		std::vector<ComPtr<ID3D12Resource>> m_retired;
+
+		// footprint scratch for upload()
+		std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> m_layouts;
+		std::vector<UINT> m_rows;
+		std::vector<UINT64> m_row_sizes;
+
+		stats m_stats{};
+	};
+}
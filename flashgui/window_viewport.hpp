@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "dxgicontext.h"
+
+namespace fgui {
+	using viewport_handle = uint32_t;
+
+	// Another OS window drawn by the same context: its own swapchain, everything else (device, queue, fonts,
+	// pipelines, frame resources and their upload heaps) is the main window's. Drawn into the frame's command
+	// list between begin/end_viewport, executed with it and presented right after it.
+	struct window_viewport {
+		static constexpr uint32_t buffer_count = 2; // the main swapchain paces the frames
+
+		HWND hwnd = nullptr; // owned by the caller
+
+		// GPU side, owned by s_dxgicontext
+		ComPtr<IDXGISwapChain3> swapchain;
+		std::vector<ComPtr<ID3D12Resource>> back_buffers;
+		ComPtr<ID3D12DescriptorHeap> rtv_heap;
+		vec2i size;              // of the buffers, follows the client rect at the first begin_viewport of a frame
+		uint32_t back_index = 0; // buffer the open frame draws into
+		bool used = false;       // drawn into the open frame, submit presents it
+	};
+}